@@ -31,6 +31,13 @@ if ( ZLIB_FOUND )
   SET(DGtalLibDependencies ${DGtalLibDependencies} ${ZLIB_LIBRARIES})
 endif( ZLIB_FOUND )
 
+# -----------------------------------------------------------------------------
+# Looking for threads (std::thread based parallel algorithms)
+# -----------------------------------------------------------------------------
+set(THREADS_PREFER_PTHREAD_FLAG ON)
+FIND_PACKAGE(Threads REQUIRED)
+SET(DGtalLibDependencies ${DGtalLibDependencies} ${CMAKE_THREAD_LIBS_INIT})
+
 # -----------------------------------------------------------------------------
 # Setting librt dependency on Linux
 # -----------------------------------------------------------------------------
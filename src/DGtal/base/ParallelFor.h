@@ -0,0 +1,265 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ParallelFor.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ParallelFor.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ParallelFor_RECURSES)
+#error Recursive header files inclusion detected in ParallelFor.h
+#else // defined(ParallelFor_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ParallelFor_RECURSES
+
+#if !defined ParallelFor_h
+/** Prevents repeated inclusion of headers. */
+#define ParallelFor_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <cstddef>
+#include <vector>
+#include <iterator>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /**
+   * Description of struct 'ParallelExecutionPolicy' <p>
+   * \brief Aim: Tells an algorithm how to execute its data-parallel
+   * parts: with how many threads (see functions::parallelFor), and
+   * by batches of how many consecutive rows when it sweeps an image
+   * along strided (non-contiguous) dimensions.
+   *
+   * The default policy is serial.
+   *
+   * @code
+   * // Distance transformation with all the cores of the machine.
+   * DistanceTransformation< Z3i::Space, Predicate, Z3i::L2Metric >
+   *   dt( domain, predicate, Z3i::l2Metric, ParallelExecutionPolicy( 0 ) );
+   * @endcode
+   *
+   * @note The batch size is set with withBatchSize() rather than with
+   * a second constructor argument, so that a brace-enclosed
+   * periodicity specification like `{ {true, false} }` is never
+   * mistaken for a policy.
+   */
+  struct ParallelExecutionPolicy
+  {
+    /**
+     * Constructor.
+     * @param threads the number of threads (0 means as many as the
+     * hardware supports, 1 is serial).
+     */
+    explicit ParallelExecutionPolicy( unsigned int threads = 1 )
+      : nbThreads( threads ), batchSize( 16 ) {}
+
+    /**
+     * @param batch the number of consecutive rows processed together
+     * by a thread when sweeping along a strided dimension (at least 1).
+     * @return a copy of this policy with the given batch size.
+     */
+    ParallelExecutionPolicy withBatchSize( std::size_t batch ) const
+    {
+      ParallelExecutionPolicy other( *this );
+      other.batchSize = batch == 0 ? 1 : batch;
+      return other;
+    }
+
+    /// @return 'true' if the policy asks for a serial execution.
+    bool isSerial() const { return nbThreads == 1; }
+
+    /// The number of threads (0 means as many as the hardware supports).
+    unsigned int nbThreads;
+    /// The number of consecutive rows in a batch.
+    std::size_t  batchSize;
+  };
+
+  namespace functions
+  {
+    /**
+     * @return the number of threads that may run concurrently on this
+     * machine (at least 1).
+     */
+    inline
+    unsigned int hardwareConcurrency();
+
+    /**
+     * Normalizes a user given number of threads: 0 means "as many as
+     * the hardware supports", otherwise the value is returned as is.
+     *
+     * @param nbThreads the requested number of threads.
+     * @return the effective number of threads (at least 1).
+     */
+    inline
+    unsigned int effectiveNbThreads( unsigned int nbThreads );
+
+    /**
+     * Splits the integer range [0,n) into \a nbChunks contiguous
+     * chunks of (almost) equal sizes. The chunk boundaries only depend
+     * on \a n and \a nbChunks, so that any computation using them is
+     * deterministic whatever the scheduling of the threads.
+     *
+     * @param n the size of the range.
+     * @param nbChunks the number of chunks (at least 1).
+     * @return a vector of \a nbChunks + 1 increasing indices, starting
+     * with 0 and ending with \a n.
+     */
+    inline
+    std::vector< std::size_t > chunkBounds( std::size_t n, unsigned int nbChunks );
+
+    /**
+     * Executes \a f on contiguous chunks of the range [0,n), each chunk
+     * being processed by its own thread (std::thread). The call blocks
+     * until all chunks are processed. When \a nbThreads is 1 (or the
+     * range is too small), \a f is directly called as `f(0,0,n)` in the
+     * calling thread, hence without any threading overhead.
+     *
+     * If \a f throws in some thread, the first exception is rethrown in
+     * the calling thread once all threads have joined.
+     *
+     * @code
+     * std::vector<double> v( 1000 );
+     * functions::parallelFor( v.size(), 4,
+     *   [&v] ( unsigned int, std::size_t b, std::size_t e )
+     *   { for ( std::size_t i = b; i < e; ++i ) v[ i ] = sqrt( i ); } );
+     * @endcode
+     *
+     * @tparam TFunctor the type of a functor `(unsigned int chunk,
+     * std::size_t begin, std::size_t end) -> void`.
+     *
+     * @param n the size of the range.
+     *
+     * @param nbThreads the number of threads (0 means as many as the
+     * hardware supports).
+     *
+     * @param f the functor called once per chunk, with its index and
+     * its bounds.
+     *
+     * @param minChunkSize the minimal number of elements per chunk, in
+     * order to avoid spawning threads for tiny tasks.
+     */
+    template <typename TFunctor>
+    void parallelFor( std::size_t n, unsigned int nbThreads, TFunctor f,
+                      std::size_t minChunkSize = 1 );
+
+    /**
+     * Same as parallelFor, but on an iterator range [itb,ite). The
+     * functor \a f is called as `f(chunk, it_begin, it_end)`, where
+     * [it_begin,it_end) is a contiguous subrange of [itb,ite). Forward
+     * iterators are enough, chunk starting iterators being computed
+     * beforehand in the calling thread.
+     *
+     * @tparam TIterator any model of forward iterator.
+     * @tparam TFunctor the type of a functor `(unsigned int chunk,
+     * TIterator begin, TIterator end) -> void`.
+     *
+     * @param itb an iterator on the first element of the range.
+     * @param ite an iterator after the last element of the range.
+     * @param nbThreads the number of threads (0 means as many as the
+     * hardware supports).
+     * @param f the functor called once per chunk.
+     * @param minChunkSize the minimal number of elements per chunk.
+     * @return the number of chunks actually used.
+     */
+    template <typename TIterator, typename TFunctor>
+    unsigned int parallelForRange( TIterator itb, TIterator ite,
+                                   unsigned int nbThreads, TFunctor f,
+                                   std::size_t minChunkSize = 1 );
+
+    /**
+     * Computes the sum of `f(i)` for i in [0,n) with several threads.
+     * The range is cut into blocks of \a blockSize consecutive
+     * indices, summed in order, then the block sums are added in
+     * order. Blocks do not depend on the number of threads, so the
+     * result is the same (bit for bit) whatever \a nbThreads.
+     *
+     * @tparam TFunctor the type of a functor `(std::size_t i) -> double`.
+     *
+     * @param n the size of the range.
+     * @param nbThreads the number of threads (0 means as many as the
+     * hardware supports).
+     * @param f the functor called once per index, possibly by several
+     * threads at once.
+     * @param blockSize the number of indices of a block.
+     * @return the sum.
+     */
+    template <typename TFunctor>
+    double parallelSum( std::size_t n, unsigned int nbThreads, const TFunctor & f,
+                        std::size_t blockSize = 4096 );
+
+    /**
+     * Sorts the range [itb,ite) with several threads: contiguous
+     * chunks are sorted by their own thread (std::sort), then merged
+     * pairwise (std::inplace_merge), the merges of a round being done
+     * in parallel. Like std::sort, the sort is not stable, but the
+     * result is the same whatever the number of threads as soon as
+     * equivalent elements are equal.
+     *
+     * @tparam TRandomIterator any model of random access iterator.
+     * @tparam TCompare the type of a strict weak ordering on the elements.
+     *
+     * @param itb an iterator on the first element of the range.
+     * @param ite an iterator after the last element of the range.
+     * @param nbThreads the number of threads (0 means as many as the
+     * hardware supports).
+     * @param comp the comparison functor.
+     * @param minChunkSize the minimal number of elements per chunk.
+     */
+    template <typename TRandomIterator, typename TCompare>
+    void parallelSort( TRandomIterator itb, TRandomIterator ite,
+                       unsigned int nbThreads, TCompare comp,
+                       std::size_t minChunkSize = 4096 );
+
+    /**
+     * Same as parallelSort( itb, ite, nbThreads, comp ) with the
+     * elements compared by operator<.
+     *
+     * @tparam TRandomIterator any model of random access iterator.
+     *
+     * @param itb an iterator on the first element of the range.
+     * @param ite an iterator after the last element of the range.
+     * @param nbThreads the number of threads (0 means as many as the
+     * hardware supports).
+     */
+    template <typename TRandomIterator>
+    void parallelSort( TRandomIterator itb, TRandomIterator ite,
+                       unsigned int nbThreads );
+
+  } // namespace functions
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/ParallelFor.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ParallelFor_h
+
+#undef ParallelFor_RECURSES
+#endif // else defined(ParallelFor_RECURSES)
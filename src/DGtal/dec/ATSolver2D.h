@@ -169,6 +169,12 @@ namespace DGtal
     PrimalForm0           former_v0;
     /// The primal 0-form lambda/(4epsilon) (stored for performance)
     PrimalForm0           l_1_over_4e;
+    /// The solver for u, kept so that its symbolic analysis is reused
+    /// by all the alternate steps (the pattern of its operator does not change)
+    SolverU2              solver_u2;
+    /// The solver for v, kept so that its symbolic analysis is reused
+    /// by all the alternate steps (the pattern of its operator does not change)
+    SolverV0              solver_v0;
 
   public:
     // The map Surfel -> Index that gives the index of the surfel in 2-forms.
@@ -553,12 +559,11 @@ namespace DGtal
         + primal_AD2.transpose() * dec_helper::diagonal( v1_squared ) * primal_AD2;
 
       if ( verbose >= 2 ) trace.info() << "Prefactoring matrix U associated to u" << std::endl;
-      SolverU2 solver_u2;
       solver_u2.compute( ope_u2 );
       for ( Dimension d = 0; d < u2.size(); ++d )
         {
           if ( verbose >= 2 ) trace.info() << "Solving U u[" << d << "] = a g[" << d << "]" << std::endl;
-          u2[ d ] = solver_u2.solve( alpha_g2[ d ] );
+          u2[ d ] = solver_u2.solve( alpha_g2[ d ], u2[ d ] );
           if ( verbose >= 2 ) trace.info() << "  => " << ( solver_u2.isValid() ? "OK" : "ERROR" )
                                            << " " << solver_u2.myLinearAlgebraSolver.info() << std::endl;
           solve_ok = solve_ok && solver_u2.isValid();
@@ -576,10 +581,9 @@ namespace DGtal
 	+ M01.transpose() * dec_helper::diagonal( squared_norm_d_u2 ) * M01;
 
       if ( verbose >= 2 ) trace.info() << "Prefactoring matrix V associated to v" << std::endl;
-      SolverV0 solver_v0;
       solver_v0.compute( ope_v0 );
       if ( verbose >= 2 ) trace.info() << "Solving V v = l/4e * 1" << std::endl;
-      v0 = solver_v0.solve( l_1_over_4e );
+      v0 = solver_v0.solve( l_1_over_4e, former_v0 );
       if ( verbose >= 2 ) trace.info() << "  => " << ( solver_v0.isValid() ? "OK" : "ERROR" )
                                        << " " << solver_v0.myLinearAlgebraSolver.info() << std::endl;
       solve_ok = solve_ok && solver_v0.isValid();
@@ -41,6 +41,10 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <algorithm>
+#include <vector>
+#include <utility>
+#include <type_traits>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/base/Clone.h"
@@ -51,6 +55,31 @@
 namespace DGtal
 {
 
+  namespace detail
+  {
+    /// Tells if a linear algebra solver splits compute into a symbolic
+    /// analyzePattern and a numeric factorize (like Eigen sparse solvers).
+    template <typename TLinearAlgebraSolver, typename TMatrix, typename = void>
+    struct HasSymbolicFactorization : std::false_type {};
+
+    template <typename TLinearAlgebraSolver, typename TMatrix>
+    struct HasSymbolicFactorization<TLinearAlgebraSolver, TMatrix,
+      decltype( std::declval<TLinearAlgebraSolver&>().analyzePattern( std::declval<const TMatrix&>() ),
+                std::declval<TLinearAlgebraSolver&>().factorize( std::declval<const TMatrix&>() ),
+                void() )> : std::true_type {};
+
+    /// Tells if a linear algebra solver may start from an initial
+    /// guess (like Eigen iterative solvers).
+    template <typename TLinearAlgebraSolver, typename TVector, typename = void>
+    struct HasSolveWithGuess : std::false_type {};
+
+    template <typename TLinearAlgebraSolver, typename TVector>
+    struct HasSolveWithGuess<TLinearAlgebraSolver, TVector,
+      decltype( std::declval<const TLinearAlgebraSolver&>().solveWithGuess( std::declval<const TVector&>(),
+                                                                          std::declval<const TVector&>() ),
+                void() )> : std::true_type {};
+  } // namespace detail
+
   /////////////////////////////////////////////////////////////////////////////
   // template class DiscreteExteriorCalculusSolver
   /**
@@ -58,6 +87,14 @@ namespace DGtal
    * \brief Aim:
    * This wraps a linear algebra solver around a discrete exterior calculus.
    *
+   * When the linear algebra solver separates the symbolic analysis of
+   * the operator (analyzePattern) from its numeric factorization
+   * (factorize), as Eigen sparse solvers do, the solver remembers the
+   * sparsity pattern of the last operator and successive calls to
+   * compute with operators sharing this pattern (e.g. differing only
+   * by their weights) only refactorize numerically. Iterative solvers
+   * may also be warm-started from a previous solution (see solve).
+   *
    * @tparam TCalculus should be DiscreteExteriorCalculus.
    * @tparam TLinearAlgebraSolver should be a model of CLinearAlgebraSolver.
    * @tparam order_in is the input order of the linear problem.
@@ -81,6 +118,7 @@ namespace DGtal
     typedef LinearOperator<Calculus, order_in, duality_in, order_out, duality_out> Operator;
     typedef KForm<Calculus, order_in, duality_in> SolutionKForm;
     typedef KForm<Calculus, order_out, duality_out> InputKForm;
+    typedef typename Operator::Container Matrix;
 
     /**
      * Constructor.
@@ -107,6 +145,8 @@ namespace DGtal
 
     /**
      * Prefactorize problem / set problem operator.
+     * The symbolic analysis of the previous operator is reused if
+     * \a linear_operator has the same sparsity pattern.
      * @param linear_operator linear operator.
      * @return *this.
      */
@@ -119,6 +159,28 @@ namespace DGtal
      */
     SolutionKForm solve(const InputKForm& input_kform) const;
 
+    /**
+     * Solve prefactorized / set problem input, starting from an
+     * initial guess if the linear algebra solver is iterative (the
+     * guess is ignored by direct solvers).
+     * @param input_kform input k-form.
+     * @param initial_guess a guess of the solution, e.g. the solution of a previous close problem.
+     * @return problem solution.
+     */
+    SolutionKForm solve(const InputKForm& input_kform, const SolutionKForm& initial_guess) const;
+
+    /**
+     * @return 'true' if the last call to compute has reused the
+     * symbolic analysis of the previous operator.
+     */
+    bool isPatternReused() const;
+
+    /**
+     * Forgets the sparsity pattern of the last operator, so that the
+     * next call to compute performs a full factorization.
+     */
+    void forgetPattern();
+
     /**
      * Checks the validity/consistency of the object.
      * @return 'true' if the object is valid, 'false' otherwise.
@@ -127,12 +189,66 @@ namespace DGtal
 
     // ------------------------- Private Datas --------------------------------
   private:
+    /**
+     * Outer indices of the last analyzed operator, empty if none.
+     */
+    std::vector<std::ptrdiff_t> myPatternOuterIndices;
+
+    /**
+     * Inner indices of the last analyzed operator.
+     */
+    std::vector<std::ptrdiff_t> myPatternInnerIndices;
+
+    /**
+     * Number of rows of the last analyzed operator.
+     */
+    std::ptrdiff_t myPatternRows;
+
+    /**
+     * Tells if the last call to compute has reused the symbolic analysis.
+     */
+    bool myPatternReused;
 
     // ------------------------- Hidden services ------------------------------
   protected:
 
     // ------------------------- Internals ------------------------------------
   private:
+    /**
+     * Factorizes with a solver without symbolic analysis.
+     * @param matrix the operator matrix.
+     */
+    void computeLinearAlgebraSolver(const Matrix& matrix, std::false_type);
+
+    /**
+     * Factorizes numerically, after a symbolic analysis if the pattern of \a matrix has changed.
+     * @param matrix the operator matrix.
+     */
+    void computeLinearAlgebraSolver(const Matrix& matrix, std::true_type);
+
+    /**
+     * @param matrix the operator matrix.
+     * @return 'true' if \a matrix has the sparsity pattern of the last analyzed operator.
+     */
+    bool hasSamePattern(const Matrix& matrix) const;
+
+    /**
+     * Solves without initial guess.
+     * @param input the input vector.
+     * @param guess ignored.
+     * @return the solution vector.
+     */
+    template <typename TVector>
+    TVector solveLinearAlgebraSolver(const TVector& input, const TVector& guess, std::false_type) const;
+
+    /**
+     * Solves from an initial guess.
+     * @param input the input vector.
+     * @param guess the initial guess.
+     * @return the solution vector.
+     */
+    template <typename TVector>
+    TVector solveLinearAlgebraSolver(const TVector& input, const TVector& guess, std::true_type) const;
 
   }; // end of class DiscreteExteriorCalculusSolver
 
@@ -54,6 +54,7 @@
 #include "DGtal/topology/CCellFunctor.h"
 #include "DGtal/topology/CanonicSCellEmbedder.h"
 #include "DGtal/topology/SCellsFunctors.h"
+#include "DGtal/kernel/sets/DigitalSetSelector.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -92,7 +93,8 @@ public:
   typedef typename KSpace::SCell Spel;
   typedef typename KSpace::Point Point;
   typedef typename KSpace::Space::RealPoint RealPoint;
-  typedef Z2i::DigitalSet::ConstIterator KernelConstIterator;
+  typedef typename DigitalSetSelector< Domain, BIG_DS + HIGH_VAR_DS >::Type::ConstIterator
+  KernelConstIterator;
 
   typedef std::pair< KernelConstIterator, KernelConstIterator > PairIterators;
   typedef CanonicSCellEmbedder< KSpace > Embedder;
@@ -458,7 +460,8 @@ public:
   typedef typename KSpace::SCell Spel;
   typedef typename KSpace::Point Point;
   typedef typename KSpace::Space::RealPoint RealPoint;
-  typedef Z2i::DigitalSet::ConstIterator KernelConstIterator;
+  typedef typename DigitalSetSelector< Domain, BIG_DS + HIGH_VAR_DS >::Type::ConstIterator
+  KernelConstIterator;
 
   typedef std::pair< KernelConstIterator, KernelConstIterator > PairIterators;
   typedef CanonicSCellEmbedder< KSpace > Embedder;
@@ -825,7 +828,8 @@ public:
   typedef typename KSpace::SCell Spel;
   typedef typename KSpace::Point Point;
   typedef typename KSpace::Space::RealPoint RealPoint;
-  typedef Z3i::DigitalSet::ConstIterator KernelConstIterator;
+  typedef typename DigitalSetSelector< Domain, BIG_DS + HIGH_VAR_DS >::Type::ConstIterator
+  KernelConstIterator;
 
 
   typedef std::pair< KernelConstIterator, KernelConstIterator > PairIterators;
@@ -41,8 +41,10 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ParallelFor.h"
 #include "DGtal/topology/DigitalSurface.h"
 
 #include "DGtal/helpers/StdDefs.h"
@@ -79,6 +81,15 @@ namespace DGtal
    *
    * To minimize this energy, instead of solving the associated sparse linear system as described in @cite coeurjolly17regDGCI,
    * we perform a gradient descent strategy which allows us a finer control over the vertices displacement (see advection methods).
+   * A nonlinear conjugate gradient descent is also available (see regularizeConjugateGradient()).
+   *
+   * The surfel/pointel incidences are precomputed as compressed
+   * arrays in both directions (pointels of each surfel, surfels of
+   * each pointel), so that the energy gradient is evaluated without
+   * scattered writes, possibly on several threads (see the
+   * ParallelExecutionPolicy given to the constructor). The energy is
+   * summed by blocks of fixed size, so that the results do not depend
+   * on the number of threads.
    *
    * @see testDigitalSurfaceRegularization.cpp
    *
@@ -110,9 +121,13 @@ namespace DGtal
     
     /**
      * Default constructor.
+     * @param aDigSurf the digital surface to regularize.
+     * @param aPolicy tells how many threads compute the gradients and
+     * the advections (serial by default).
      */
-    DigitalSurfaceRegularization(CountedPtr<DigSurface> aDigSurf)
-    :  myInit(false), myVerbose(false), myDigitalSurface(aDigSurf)
+    DigitalSurfaceRegularization(CountedPtr<DigSurface> aDigSurf,
+                                 ParallelExecutionPolicy const & aPolicy = ParallelExecutionPolicy())
+    :  myInit(false), myVerbose(false), myPolicy(aPolicy), myDigitalSurface(aDigSurf)
     {
       myK = SH3::getKSpace( myDigitalSurface );
     }
@@ -237,6 +252,8 @@ namespace DGtal
      * during the gradient descent. By default, points are shifted by a fraction of the energy
      * gradient vector (and the default function is thus @f$ p \leftarrow p + v@f$ with
      * @f$ v = -dt  \nabla E_p@f$). See @see clampedAdvection for another advection strategy.
+     * The advection function is called concurrently on distinct points
+     * when several threads are used.
      *
      * The energy at the final step is returned.
      *
@@ -277,6 +294,46 @@ namespace DGtal
          return regularize(nbIters,dt,epsilon,
                            [](SHG3::RealPoint& p,SHG3::RealPoint& o,SHG3::RealVector& v){ p += v; });
        }
+
+    /**
+     * @brief Regularization loop by nonlinear conjugate gradient.
+     *
+     * Same as regularize(), but points are moved along conjugate
+     * directions (Polak-Ribiere formula, clamped to positive values)
+     * instead of the energy gradient. A step which increases the
+     * energy is undone, the learning step being halved as in
+     * regularize() and the direction being reset to the gradient. It
+     * usually needs fewer iterations to reach the same energy.
+     *
+     * @param [in] nbIters maxium number of steps
+     * @param [in] dt initial learning rate
+     * @param [in] epsilon minimum learning rate
+     * @param [in] advectionFunc advection function/functor/lambda (see regularize()).
+     * @tparam AdvectionFunction type of advection function, functor or lambda (RealPoint, RealPoint, RealVector)->RealPoint.
+     * @return the energy at the final step.
+     */
+    template <typename AdvectionFunction>
+    double regularizeConjugateGradient(const unsigned int nbIters,
+                                       const double dt,
+                                       const double epsilon,
+                                       const AdvectionFunction & advectionFunc);
+
+    /**
+     * @brief Regularization loop by nonlinear conjugate gradient, with
+     * the default advection function @f$ p = p + v@f$.
+     *
+     * @param [in] nbIters maxium number of steps (default=200)
+     * @param [in] dt initial learning rate (default = 1.0)
+     * @param [in] epsilon minimum learning rate (default = 0.0001)
+     * @return the energy at the final step.
+     */
+    double regularizeConjugateGradient(const unsigned int nbIters = 200,
+                                       const double dt = 1.0,
+                                       const double epsilon = 0.0001)
+    {
+      return regularizeConjugateGradient(nbIters,dt,epsilon,
+                                         [](SHG3::RealPoint& p,SHG3::RealPoint& o,SHG3::RealVector& v){ p += v; });
+    }
       
     
    
@@ -410,6 +467,31 @@ namespace DGtal
      * Internal init method to set up topological caches.
      */
     void cacheInit();
+
+    /**
+     * Internal method to copy the normal vectors of the surfels
+     * in mySortedNormals.
+     */
+    void cacheNormals();
+
+    /**
+     * Computes the energy gradient vector and returns the energy value.
+     * @tparam constantCoeffs when 'true', uses the constant weights,
+     * otherwise the local ones.
+     * @return the energy value.
+     */
+    template <bool constantCoeffs>
+    double computeGradientImpl();
+
+    /**
+     * Moves all the regularized points along the vectors of a field.
+     * @param direction a vector per pointel.
+     * @param step the factor applied to each vector.
+     * @param advectionFunc the advection function (see regularize()).
+     */
+    template <typename AdvectionFunction>
+    void advect(const Positions & direction, const double step,
+                const AdvectionFunction & advectionFunc);
     
     
     // ------------------------- Private Datas --------------------------------
@@ -437,6 +519,9 @@ namespace DGtal
     
     ///Flag for verbose messages
     bool myVerbose;
+
+    ///Number of threads used to compute the gradients and advections
+    ParallelExecutionPolicy myPolicy;
     
     ///Input DigitalSurface to regularize
     CountedPtr<DigSurface> myDigitalSurface;
@@ -452,15 +537,20 @@ namespace DGtal
     
     ///Gradient of the energy w.r.t. vertex positons
     Positions myGradient;
-    
+
+    ///Previous gradient (conjugate gradient descent)
+    Positions myPreviousGradient;
+
+    ///Descent direction (conjugate gradient descent)
+    Positions myDirection;
+
+    ///Positions before the last step (conjugate gradient descent)
+    Positions myPreviousPositions;
     
   
     // ---------------------------------------------------------------
     ///Internal members to store precomputed topological informations
     
-    ///Gradient of the quad alignement w.r.t. vertex positons
-    Positions myGradientAlign;
-    
     ///Instance of the KSpace
     SH3::KSpace myK;
     
@@ -477,12 +567,20 @@ namespace DGtal
     std::vector< SH3::Idx > myAlignPointelsIdx;
     ///Adjacent pointels for the Alignement energy term
     std::vector< SH3::Cell > myAlignPointels;
-    ///Number of adjacent edges to pointels
-    std::vector<unsigned char> myNumberAdjEdgesToPointel;
-    ///Indices of cells foor the Fairness term
+    ///For each pointel, the first of its surfels in myPointelAlignSurfels (plus the end)
+    std::vector< std::size_t > myPointelAlignOffsets;
+    ///Surfels around each pointel, by increasing index (indices in mySortedNormals)
+    std::vector< DGtal::uint32_t > myPointelAlignSurfels;
+    ///For each surfel around a pointel, the next pointel of its quad
+    std::vector< DGtal::uint32_t > myPointelAlignNext;
+    ///Surfels in the order they are met around pointels (indices in mySurfels)
+    std::vector< DGtal::uint32_t > mySortedSurfels;
+    ///Normal vectors of the surfels, in the order of mySortedSurfels
+    Normals mySortedNormals;
+    ///Indices of cells foor the Fairness term (the face pointel then its adjacent ones)
     std::vector< SH3::Idx > myFairnessPointelsIdx;
-    ///Number of adjacent faces to given vertex
-    std::vector< unsigned char > myNbAdjacent;
+    ///For each face, the first of its cells in myFairnessPointelsIdx (plus the end)
+    std::vector< std::size_t > myFairnessOffsets;
     ///All faces of the dual digital surfacce
     SH3::PolygonalSurface::FaceRange myFaces;
     
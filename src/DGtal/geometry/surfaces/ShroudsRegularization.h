@@ -41,8 +41,10 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ParallelFor.h"
 #include "DGtal/topology/CanonicSCellEmbedder.h"
 #include "DGtal/topology/IndexedDigitalSurface.h"
 #include "DGtal/topology/DigitalSurface2DSlice.h"
@@ -60,6 +62,13 @@ namespace DGtal {
   /// surface, generally according to curvature-related
   /// regularizers.
   ///
+  /// Each optimization step moves every vertex according to the
+  /// positions of the previous step only, so that the vertices (and
+  /// thus the slices) are processed by the threads of the
+  /// ParallelExecutionPolicy given at construction. Energies and
+  /// displacement norms are summed by blocks of fixed size: results
+  /// do not depend on the number of threads.
+  ///
   /// @see \ref moduleShrouds
   ///
   /// @note This method is limited to \b closed digital surfaces.
@@ -108,12 +117,17 @@ namespace DGtal {
     /// Constructor from (closed) \a surface.
     /// Also calls methods \ref precomputeTopology and \ref init.
     /// @param surface a counted pointer on an indexed digital surface.
+    /// @param policy tells how many threads run the optimization
+    /// steps and the energy computations (serial by default).
     ///
     /// @note Complexity is linear in the number of surfels of \a surface.
-    ShroudsRegularization( CountedPtr< IdxDigitalSurface > surface )
+    ShroudsRegularization( CountedPtr< IdxDigitalSurface > surface,
+                           ParallelExecutionPolicy const & policy
+                           = ParallelExecutionPolicy() )
       : myPtrIdxSurface( surface ),
 	myPtrK( &surface->container().space() ),
-	myEpsilon( 0.0001 ), myAlpha( 1.0 ), myBeta( 1.0 )
+	myEpsilon( 0.0001 ), myAlpha( 1.0 ), myBeta( 1.0 ),
+	myPolicy( policy )
     {
       precomputeTopology();
       init();
@@ -239,21 +253,9 @@ namespace DGtal {
     /// @name Geometric services
     /// @{
 
-    /// Computes the distances between the vertices along slices.
-    void parameterize()
-    {
-      Scalar d = 0.0;
-      // Vertex n = 0;
-      for ( Dimension i = 0; i < 3; ++i )
-	for ( Vertex v = 0; v < myT.size(); ++v )
-	  {
-	    if ( myNext[ i ][ v ] == myInvalid )  continue; // not a valid slice
-	    myNextD[ i ][ v ] = ( position( myNext[ i ][ v ] ) - position( v ) ).norm();
-	    myPrevD[ i ][ v ] = ( position( myPrev[ i ][ v ] ) - position( v ) ).norm();
-	    d += myNextD[ i ][ v ];
-	    //	    n += 1;
-	  }
-    }
+    /// Computes the distances between the vertices along slices
+    /// (and the cache of vertex positions).
+    void parameterize();
 
     /// @param v_i a pair (vertex,tangent direction)
     /// @return the coefficient for centered first-order finite difference.
@@ -464,6 +466,12 @@ namespace DGtal {
     /// Forces t to stay in ]0,1[
     void enforceBounds();
 
+    /// @return the parallel execution policy of the optimization.
+    const ParallelExecutionPolicy & policy() const
+    {
+      return myPolicy;
+    }
+
     /// @}
     
     // -------------------------- internal methods ------------------------------
@@ -525,6 +533,36 @@ namespace DGtal {
 	}
     }
 
+    /// Computes the positions of all vertices in \ref myX.
+    void cachePositions();
+
+    /// @param v any valid vertex.
+    /// @return its position as stored by the last \ref cachePositions.
+    RealPoint cachedPosition( const Vertex v ) const
+    {
+      return RealPoint( myX[ 0 ][ v ], myX[ 1 ][ v ], myX[ 2 ][ v ] );
+    }
+
+    /// @param randomization the amplitude of the perturbations.
+    /// @return the perturbations of the parameters of all vertices
+    /// (drawn with `rand()` in vertex order), or an empty vector if \a
+    /// randomization is zero.
+    Scalars perturbations( const double randomization ) const;
+
+    /// Sets the parameters to a damped combination of \a newT and of
+    /// the current ones, forces them to stay in ]0,1[ and measures
+    /// the displacements of the vertices.
+    ///
+    /// @param newT the new parameter of each vertex.
+    /// @param a the weight of the new parameters.
+    /// @param b the weight of the current parameters.
+    /// @return the pair of \f$ l_\infty \f$ and \f$ l_2 \f$ norms of
+    /// vertex displacements.
+    ///
+    /// @pre \ref myX contains the positions of the current parameters.
+    std::pair<double,double> dampedUpdate( const Scalars & newT,
+                                           const double a, const double b );
+
     /// @}
     
     // -------------------------- data ---------------------------------
@@ -565,6 +603,11 @@ namespace DGtal {
     /// for each vertex, the estimated distance to its predessor on
     /// the slice of given axis direction.
     Scalars                            myPrevD[ 3 ];
+    /// the number of threads used by the optimization.
+    ParallelExecutionPolicy            myPolicy;
+    /// for each axis, the coordinates of the vertex positions along
+    /// this axis (updated by \ref parameterize).
+    Scalars                            myX[ 3 ];
     
   }; // end of class ShroudsRegularization
   
@@ -586,7 +629,9 @@ namespace DGtal {
   ( CountedPtr< IndexedDigitalSurface< TDigitalSurfaceContainer > > surface,
     double eps = 0.00001 )
   {
-    return ShroudsRegularization<TDigitalSurfaceContainer>( surface, eps );
+    ShroudsRegularization<TDigitalSurfaceContainer> shrouds( surface );
+    shrouds.setParams( eps );
+    return shrouds;
   }
   
 } // namespace surfaces
@@ -41,15 +41,47 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <iterator>
 #include <map>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Alias.h"
+#include "DGtal/base/CSTLAssociativeContainer.h"
+#include "DGtal/base/ParallelFor.h"
 #include "DGtal/geometry/surfaces/estimation/CSurfelLocalEstimator.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
 {
-  
+  namespace detail
+  {
+    /// Tells if an estimator has a multi-threaded range eval( itb,
+    /// ite, result, nbThreads ) (like integral invariant estimators).
+    template <typename TEstimator, typename TIterator, typename = void>
+    struct HasThreadedRangeEval : std::false_type {};
+
+    template <typename TEstimator, typename TIterator>
+    struct HasThreadedRangeEval<TEstimator, TIterator,
+      decltype( std::declval<const TEstimator&>().eval
+                ( std::declval<TIterator>(), std::declval<TIterator>(),
+                  std::declval< std::back_insert_iterator< std::vector< typename TEstimator::Quantity > > >(),
+                  0u ),
+                void() )> : std::true_type {};
+
+    /// Tells if an associative container may be populated by several
+    /// threads at once (like CellHashMap).
+    template <typename TContainer, typename = void>
+    struct HasConcurrentInsert : std::false_type {};
+
+    template <typename TContainer>
+    struct HasConcurrentInsert<TContainer,
+      decltype( std::declval<TContainer&>().concurrentInsert( std::declval<const typename TContainer::value_type&>() ),
+                TContainer::isPackable( std::declval<const typename TContainer::key_type&>() ),
+                void() )> : std::true_type {};
+  } // namespace detail
+
   /////////////////////////////////////////////////////////////////////////////
   // template class EstimatorCache
   /**
@@ -66,10 +98,21 @@ namespace DGtal
    *
    * This class is also a model of concepts::CSurfelLocalEstimator
    *
+   * When the same quantities are looked up many times, the container
+   * may be a CellHashMap instead of a std::map. The cache may then be
+   * populated by several threads, see init( aH, itb, ite, nbThreads ).
+   *
+   * @code
+   * typedef EstimatorCache< Estimator, CellHashMap< Surfel, Quantity > > Cache;
+   * Cache cache( estimator );
+   * cache.init( h, surface.begin(), surface.end(), 0 ); // all threads
+   * @endcode
+   *
    * @see testEstimatorCache.cpp
 
    * @tparam TEstimator any model of CSurfelLocalEstimator
-   * @tparam TContainer the associative container to use (default type: std::map<Surfel,Quantity>)
+   * @tparam TContainer the associative container Surfel -> Quantity to use, a
+   * model of concepts::CSTLAssociativeContainer (default type: std::map<Surfel,Quantity>)
    */
   template <typename TEstimator,
             typename TContainer = std::map<typename TEstimator::Surfel,
@@ -86,7 +129,7 @@ namespace DGtal
     
     ///Container type
     typedef TContainer Container;
-    BOOST_CONCEPT_ASSERT(( boost::PairAssociativeContainer<TContainer> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CSTLAssociativeContainer<TContainer> ));
     
     //Concept of CSurfelLocalEstimator
     
@@ -169,6 +212,43 @@ namespace DGtal
       
       myInit = true;
     }
+
+    /**
+     * Multi-threaded estimator initialization. This method
+     * initializes the underlying estimator, then estimates all the
+     * quantities between @a itb and @a ite with its multi-threaded
+     * range eval if it has one (its range eval otherwise), and caches
+     * them. When the container supports concurrent insertions (like
+     * CellHashMap), it is populated by the same threads.
+     *
+     * @tparam  SurfelConstIterator a const iterator on surfels.
+     * @param[in] aH the gridstep
+     * @param[in] itb iterator on the first surfel of the surface.
+     * @param[in] ite iterator after the last surfel of the surface.
+     * @param[in] nbThreads the number of threads (0 means as many as
+     * the hardware supports, 1 is the same as init( aH, itb, ite )).
+     */
+    template <typename SurfelConstIterator>
+    void init(const double aH, SurfelConstIterator itb, SurfelConstIterator ite,
+              unsigned int nbThreads)
+    {
+      if ( functions::effectiveNbThreads( nbThreads ) <= 1 )
+        return init( aH, itb, ite );
+      ASSERT(myEstimator);
+      myEstimator->init(aH,itb,ite);
+      myContainer.clear();
+
+      typedef typename std::vector<Surfel>::const_iterator VectorIterator;
+      const std::vector<Surfel> surfels( itb, ite );
+      std::vector<Quantity> quantities;
+      quantities.reserve( surfels.size() );
+      estimate( surfels, quantities, nbThreads,
+                typename detail::HasThreadedRangeEval<Estimator, VectorIterator>::type() );
+      store( surfels, quantities, nbThreads,
+             typename detail::HasConcurrentInsert<Container>::type() );
+
+      myInit = true;
+    }
     
     /**
      * Cached evaluation of the estimator at iterator @a it
@@ -286,7 +366,50 @@ namespace DGtal
     
     // ------------------------- Internals ------------------------------------
   private:
-    
+
+    /// Estimates the quantities of \a surfels with the multi-threaded range eval.
+    void estimate( const std::vector<Surfel> & surfels, std::vector<Quantity> & quantities,
+                   unsigned int nbThreads, std::true_type )
+    {
+      myEstimator->eval( surfels.begin(), surfels.end(),
+                         std::back_inserter( quantities ), nbThreads );
+    }
+
+    /// Estimates the quantities of \a surfels with the range eval.
+    void estimate( const std::vector<Surfel> & surfels, std::vector<Quantity> & quantities,
+                   unsigned int /* nbThreads */, std::false_type )
+    {
+      myEstimator->eval( surfels.begin(), surfels.end(), std::back_inserter( quantities ) );
+    }
+
+    /// Stores the quantities of \a surfels by concurrent insertions
+    /// (serially if some surfel cannot be inserted concurrently).
+    void store( const std::vector<Surfel> & surfels, const std::vector<Quantity> & quantities,
+                unsigned int nbThreads, std::true_type )
+    {
+      for ( const Surfel & s : surfels )
+        if ( ! Container::isPackable( s ) )
+          return store( surfels, quantities, nbThreads, std::false_type() );
+      myContainer.reserve( surfels.size() );
+      Container & container = myContainer;
+      functions::parallelFor
+        ( surfels.size(), nbThreads,
+          [&] ( unsigned int, std::size_t b, std::size_t e )
+          {
+            for ( std::size_t i = b; i < e; ++i )
+              container.concurrentInsert
+                ( typename Container::value_type( surfels[ i ], quantities[ i ] ) );
+          }, 1024 );
+    }
+
+    /// Stores the quantities of \a surfels serially.
+    void store( const std::vector<Surfel> & surfels, const std::vector<Quantity> & quantities,
+                unsigned int /* nbThreads */, std::false_type )
+    {
+      for ( std::size_t i = 0; i < surfels.size(); ++i )
+        myContainer.insert( std::pair<Surfel, Quantity>( surfels[ i ], quantities[ i ] ) );
+    }
+
   }; // end of class EstimatorCache
   
   
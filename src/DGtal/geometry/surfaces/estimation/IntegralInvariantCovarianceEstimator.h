@@ -45,6 +45,7 @@
 // Inclusions
 #include <iostream>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelFor.h"
 
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/kernel/BasicPointFunctors.h"
@@ -290,6 +291,42 @@ public:
                        SurfelConstIterator ite,
                        OutputIterator result ) const;
 
+  /**
+  * -- Estimation --
+  *
+  * Multi-threaded version of eval( itb, ite, result ). The range
+  * [itb,ite) is split into \a nbThreads contiguous chunks, each one
+  * being processed by its own thread with its own convolution state,
+  * so that the optimization on 0-adjacent surfels still applies
+  * within each chunk. Results are output in the same order as the
+  * range [itb,ite) and are identical to the ones of the serial
+  * version.
+  *
+  * @note The point predicate must support concurrent (read-only)
+  * queries, which is the case of images and digitized shapes.
+  *
+  * @tparam OutputIterator type of Iterator of an array of Quantity
+  * @tparam SurfelConstIterator type of (forward) Iterator on a Surfel
+  *
+  * @param[in] itb iterator defining the start of the range of surfels
+  * where we wish to compute some geometric information.
+  *
+  * @param[in] ite iterator defining the end of the range of surfels
+  * where we wish to compute some geometric information.
+  *
+  * @param[in] result output iterator of results of the computation.
+  *
+  * @param[in] nbThreads the number of threads (0 means as many as
+  * the hardware supports, 1 is the serial version).
+  *
+  * @return the updated output iterator after all outputs.
+  */
+  template <typename OutputIterator, typename SurfelConstIterator>
+  OutputIterator eval( SurfelConstIterator itb,
+                       SurfelConstIterator ite,
+                       OutputIterator result,
+                       unsigned int nbThreads ) const;
+
   /**
   * Writes/Displays the object on an output stream.
   * @param out the output stream where the object is written.
@@ -0,0 +1,474 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file IntegralInvariantMultiScaleEstimator.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module IntegralInvariantMultiScaleEstimator.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(IntegralInvariantMultiScaleEstimator_RECURSES)
+#error Recursive header files inclusion detected in IntegralInvariantMultiScaleEstimator.h
+#else // defined(IntegralInvariantMultiScaleEstimator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define IntegralInvariantMultiScaleEstimator_RECURSES
+
+#if !defined IntegralInvariantMultiScaleEstimator_h
+/** Prevents repeated inclusion of headers. */
+#define IntegralInvariantMultiScaleEstimator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/CountedConstPtrOrConstPtr.h"
+#include "DGtal/base/ParallelFor.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/math/linalg/SimpleMatrix.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/shapes/EuclideanShapesDecorator.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
+//////////////////////////////////////////////////////////////////////////////
+
+
+namespace DGtal
+{
+
+/////////////////////////////////////////////////////////////////////////////
+// template class IntegralInvariantMultiScaleEstimator
+/**
+* Description of template class 'IntegralInvariantMultiScaleEstimator' <p>
+* \brief Aim: This class implements an Integral Invariant estimator
+* which computes, for each surfel and for each radius of a given list
+* of radii, the volume and the covariance matrix of the intersection
+* of the shape with a ball centered on the surfel, and transforms it
+* into some geometric quantity. It is the scale-space counterpart of
+* IntegralInvariantVolumeEstimator and
+* IntegralInvariantCovarianceEstimator.
+*
+* @cite Coeurjo-CVIU-2014
+*
+* All the kernels are processed within a single traversal of the
+* surfels. The digital balls of all radii are merged into a single
+* list of points, each one tagged with the set of radii whose ball
+* contains it (the balls are nested, so this is the ball of greatest
+* radius). The same is done for the shifting masks used for
+* 0-adjacent surfels (as in DigitalSurfaceConvolver). Hence the point
+* predicate is evaluated once per point of the union of the kernels,
+* and its answer is accumulated into the moments of all the radii at
+* once. For \a k radii, this gives roughly \a k times fewer predicate
+* evaluations than \a k separate estimators, plus one traversal and
+* one kernel computation instead of \a k.
+*
+* The moments (volume, first and second order moments) are computed
+* exactly as in DigitalSurfaceConvolver, so that results are identical
+* to the ones of IntegralInvariantVolumeEstimator and
+* IntegralInvariantCovarianceEstimator used with each radius in turn.
+*
+* @tparam TKSpace a model of CCellularGridSpaceND, the cellular space
+* in which the shape is defined.
+*
+* @tparam TPointPredicate a model of concepts::CPointPredicate, a
+* predicate Point -> bool that defines a digital shape as a
+* characteristic function.
+*
+* @tparam TFunctor a model of functor that transforms the result of
+* the Integral Invariant estimator into some quantity. It is either a
+* functor volume -> Quantity (like
+* functors::IIMeanCurvature3DFunctor) or a functor covariance matrix
+* -> Quantity (like functors::IIPrincipalCurvaturesAndDirectionsFunctor),
+* the choice being made from its type \a Argument. It must have a
+* method `init( h, r )`, which is called once per radius on a copy of
+* the functor given at construction.
+*
+* @code
+* typedef functors::IIMeanCurvature3DFunctor<Z3i::Space> MeanCurvatureFunctor;
+* typedef IntegralInvariantMultiScaleEstimator<Z3i::KSpace, Shape, MeanCurvatureFunctor> Estimator;
+* Estimator estimator;
+* estimator.attach( K, shape );
+* estimator.setParams( { 3.0, 4.0, 6.0, 8.0 } );
+* estimator.init( h, surfels.begin(), surfels.end() );
+* std::vector< Estimator::Quantity > H; // H[ i ][ j ] is the curvature at surfel i for radius j.
+* estimator.eval( surfels.begin(), surfels.end(), std::back_inserter( H ) );
+* @endcode
+*
+* @see testIntegralInvariantMultiScaleEstimator.cpp
+*/
+template <typename TKSpace, typename TPointPredicate, typename TFunctor>
+class IntegralInvariantMultiScaleEstimator
+{
+public:
+  typedef IntegralInvariantMultiScaleEstimator< TKSpace, TPointPredicate, TFunctor> Self;
+  typedef TKSpace KSpace;
+  typedef TPointPredicate PointPredicate;
+  typedef TFunctor Functor;
+
+  BOOST_CONCEPT_ASSERT (( concepts::CCellularGridSpaceND< KSpace > ));
+  BOOST_CONCEPT_ASSERT (( concepts::CPointPredicate< PointPredicate > ));
+
+  typedef typename KSpace::Space Space;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename Space::Dimension Dimension;
+  typedef typename Space::Point Point;
+  typedef typename Space::RealPoint RealPoint;
+  typedef typename KSpace::SCell Spel;
+  typedef typename KSpace::Surfel Surfel;
+  typedef double Scalar;
+  /// The type of the covariance matrices.
+  typedef SimpleMatrix< double, Space::dimension, Space::dimension > Matrix;
+
+  /// The quantity returned by the functor for one radius.
+  typedef typename Functor::Quantity FunctorQuantity;
+  /// The returned type of the estimator: one quantity per radius, in
+  /// the order of the radii.
+  typedef std::vector< FunctorQuantity > Quantity;
+
+  /// True when the functor takes a covariance matrix, false when it
+  /// takes a volume.
+  static const bool usesCovarianceMatrix
+  = std::is_same< typename Functor::Argument, Matrix >::value;
+
+  /// A kernel point, with the bitset of the radii it belongs to.
+  typedef std::pair< Point, DGtal::uint64_t > KernelPoint;
+  /// A multi-radii kernel, i.e. a list of tagged points.
+  typedef std::vector< KernelPoint > MultiKernel;
+
+  typedef ImplicitBall<Space> KernelSupport;
+  typedef EuclideanShapesCSG< KernelSupport, KernelSupport > EuclideanMinus;
+  typedef GaussDigitizer< Space, KernelSupport > DigitalShapeKernel;
+  typedef GaussDigitizer< Space, EuclideanMinus > DigitalShape;
+
+  // ----------------------- Standard services ------------------------------
+public:
+
+  /**
+  * Default constructor. The object is invalid. The user needs to call
+  * setParams and attach.
+  *
+  * @param fct the functor for transforming the volume or the
+  * covariance matrix into some quantity. It is copied and initialized
+  * once per radius. If not precised, a default object is instantiated.
+  */
+  IntegralInvariantMultiScaleEstimator( Functor fct = Functor() );
+
+  /**
+  * Constructor.
+  *
+  * @param[in] K the cellular grid space in which the shape is defined.
+  * @param[in] aPointPredicate the shape of interest. The alias can be secured
+  * if a some counted pointer is handed.
+  * @param fct the functor for transforming the volume or the
+  * covariance matrix into some quantity.
+  */
+  IntegralInvariantMultiScaleEstimator( ConstAlias< KSpace > K,
+                                        ConstAlias< PointPredicate > aPointPredicate,
+                                        Functor fct = Functor() );
+
+  /**
+  * Copy constructor.
+  * @param other the object to clone.
+  */
+  IntegralInvariantMultiScaleEstimator ( const Self& other ) = default;
+
+  /**
+  * Assignment.
+  * @param other the object to copy.
+  * @return a reference on 'this'.
+  */
+  Self& operator= ( const Self& other ) = default;
+
+  /**
+  * Clears the object. It is now invalid.
+  */
+  void clear();
+
+  // ----------------------- Interface --------------------------------------
+public:
+
+  /// @return the grid step.
+  Scalar h() const;
+
+  /// @return the "digital" radii of the kernels, sorted increasingly.
+  const std::vector< Scalar >& radii() const;
+
+  /**
+  * Attach a shape, defined as a point predicate.
+  *
+  * @param[in] K the cellular grid space in which the shape is defined.
+  * @param aPointPredicate the shape of interest. The alias can be secured
+  * if a some counted pointer is handed.
+  */
+  void attach( ConstAlias< KSpace > K,
+               ConstAlias<PointPredicate> aPointPredicate );
+
+  /**
+  * Set specific parameters: the radii of the balls. Radii are sorted
+  * increasingly, and the quantities returned by the estimator follow
+  * this order.
+  *
+  * @param[in] dRadii the "digital" radii of the kernels (but may be
+  * non integer), at least 1 and at most 64 of them.
+  * @throw std::invalid_argument if there are no radii or more than 64.
+  */
+  void setParams( const std::vector< double >& dRadii );
+
+  /**
+  * Model of CDigitalSurfaceLocalEstimator. Initialisation. Computes
+  * the merged kernels of all the radii.
+  *
+  * @tparam SurfelConstIterator any model of forward readable iterator on Surfel.
+  * @param[in] _h grid size (must be >0).
+  * @param[in] itb iterator on the first surfel of the surface.
+  * @param[in] ite iterator after the last surfel of the surface.
+  */
+  template <typename SurfelConstIterator>
+  void init( const double _h, SurfelConstIterator itb, SurfelConstIterator ite );
+
+  /**
+  * -- Estimation --
+  *
+  * Computes the quantities of all radii at surfel *it.
+  *
+  * @tparam SurfelConstIterator type of Iterator on a Surfel
+  *
+  * @param[in] it iterator pointing on the surfel of the shape where
+  * we wish to evaluate some geometric information.
+  *
+  * @return the quantities at surfel *it, one per radius.
+  */
+  template< typename SurfelConstIterator >
+  Quantity eval ( SurfelConstIterator it ) const;
+
+  /**
+  * -- Estimation --
+  *
+  * Computes the quantities of all radii for a range of surfels
+  * [itb,ite). Moments are updated incrementally between 0-adjacent
+  * surfels, so the estimator is faster when surfels are given in a
+  * depth-first order.
+  *
+  * @tparam OutputIterator type of Iterator of an array of Quantity
+  * @tparam SurfelConstIterator type of Iterator on a Surfel
+  *
+  * @param[in] itb iterator defining the start of the range of surfels.
+  * @param[in] ite iterator defining the end of the range of surfels.
+  * @param[in] result output iterator of results of the computation.
+  * @return the updated output iterator after all outputs.
+  */
+  template <typename OutputIterator, typename SurfelConstIterator>
+  OutputIterator eval( SurfelConstIterator itb,
+                       SurfelConstIterator ite,
+                       OutputIterator result ) const;
+
+  /**
+  * -- Estimation --
+  *
+  * Multi-threaded version of eval( itb, ite, result ). The range
+  * [itb,ite) is split into \a nbThreads contiguous chunks processed
+  * concurrently. Results are output in the same order as the range
+  * [itb,ite) and are identical to the ones of the serial version.
+  *
+  * @note The point predicate must support concurrent (read-only) queries.
+  *
+  * @tparam OutputIterator type of Iterator of an array of Quantity
+  * @tparam SurfelConstIterator type of (forward) Iterator on a Surfel
+  *
+  * @param[in] itb iterator defining the start of the range of surfels.
+  * @param[in] ite iterator defining the end of the range of surfels.
+  * @param[in] result output iterator of results of the computation.
+  * @param[in] nbThreads the number of threads (0 means as many as
+  * the hardware supports, 1 is the serial version).
+  * @return the updated output iterator after all outputs.
+  */
+  template <typename OutputIterator, typename SurfelConstIterator>
+  OutputIterator eval( SurfelConstIterator itb,
+                       SurfelConstIterator ite,
+                       OutputIterator result,
+                       unsigned int nbThreads ) const;
+
+  /// @return the number of point predicate evaluations done since the
+  /// last call to init (for statistics, the multi-threaded eval adds
+  /// the evaluations of all its chunks).
+  std::size_t nbPredicateEvaluations() const;
+
+  /**
+  * Writes/Displays the object on an output stream.
+  * @param out the output stream where the object is written.
+  */
+  void selfDisplay ( std::ostream & out ) const;
+
+  /**
+  * Checks the validity/consistency of the object.
+  * @return 'true' if the object is valid, 'false' otherwise.
+  */
+  bool isValid() const;
+
+  // ------------------------- Private Datas --------------------------------
+private:
+
+  Functor myFct;                                  ///< The functor prototype.
+  std::vector< Functor > myFcts;                  ///< The functors, one per radius.
+  CountedConstPtrOrConstPtr<KSpace> myKSpace;     ///< The cellular grid space.
+  CountedConstPtrOrConstPtr<PointPredicate> myPointPredicate; ///< Smart pointer (if required) on a point predicate.
+  Domain myShapeDomain;                           ///< The domain of the shape, given by the bounds of the space.
+  MultiKernel myFullKernel;                       ///< The merged digital balls.
+  std::vector< MultiKernel > myMasks;             ///< The merged shifting masks, 3^dimension of them.
+  Scalar myH;                                     ///< precision of the grid
+  std::vector< Scalar > myRadii;                  ///< "digital" radii of the kernels.
+  mutable std::size_t myNbEvaluations;            ///< number of predicate evaluations.
+
+  /// The number of moments: volume, first order and second order moments.
+  static const std::size_t nbMoments
+  = 1 + Space::dimension + ( Space::dimension * ( Space::dimension + 1 ) ) / 2;
+
+  // ------------------------- Hidden services ------------------------------
+private:
+
+  /**
+  * Accumulates the moments of the shape points of a translated
+  * multi-radii kernel into \a moments (nbMoments values per radius).
+  *
+  * @param[in] kernel the merged kernel.
+  * @param[in] shift the translation of the kernel.
+  * @param[in] sign either 1.0 (points are added) or -1.0 (points are removed).
+  * @param[in,out] moments the moments of all radii.
+  * @return the number of point predicate evaluations.
+  */
+  std::size_t accumulate( const MultiKernel& kernel, const Point& shift,
+                          double sign, std::vector< double >& moments ) const;
+
+  /**
+  * Computes the moments of the spel \a current, either from
+  * scratch, or from the moments of a 0-adjacent spel \a last.
+  *
+  * @param[in] current the point of the current spel.
+  * @param[in] useLast when 'true', \a last and \a lastMoments are
+  * used whenever \a last is 0-adjacent to \a current.
+  * @param[in] last the point of the previous spel.
+  * @param[in] lastMoments the moments of the previous spel.
+  * @param[out] moments the moments of the current spel.
+  * @return the number of point predicate evaluations.
+  */
+  std::size_t computeMoments( const Point& current, bool useLast,
+                              const Point& last,
+                              const std::vector< double >& lastMoments,
+                              std::vector< double >& moments ) const;
+
+  /**
+  * Computes the quantities of all radii from the moments of the
+  * inner and outer spels of a surfel.
+  *
+  * @param[in] inner the moments of the inner spel.
+  * @param[in] outer the moments of the outer spel.
+  * @param[in] fcts the functors, one per radius.
+  * @return the quantities, one per radius.
+  */
+  Quantity quantities( const std::vector< double >& inner,
+                       const std::vector< double >& outer,
+                       const std::vector< Functor >& fcts ) const;
+
+  /**
+  * Computes the covariance matrix of radius \a i from moments, as
+  * DigitalSurfaceConvolver does.
+  *
+  * @param[in] moments the moments of all radii.
+  * @param[in] i the index of the radius.
+  * @return the covariance matrix.
+  */
+  Matrix covarianceMatrix( const std::vector< double >& moments,
+                           std::size_t i ) const;
+
+  /// Applies the functor \a fct of radius \a i on volumes.
+  FunctorQuantity apply( const Functor& fct, std::size_t i,
+                         const std::vector< double >& inner,
+                         const std::vector< double >& outer,
+                         std::false_type ) const;
+
+  /// Applies the functor \a fct of radius \a i on covariance matrices.
+  FunctorQuantity apply( const Functor& fct, std::size_t i,
+                         const std::vector< double >& inner,
+                         const std::vector< double >& outer,
+                         std::true_type ) const;
+
+  /**
+  * Evaluates a range of surfels. The functors are copied once per
+  * call, since covariance functors keep mutable eigen decomposition
+  * buffers: concurrent calls are thus safe.
+  *
+  * @param[in] itb iterator defining the start of the range of surfels.
+  * @param[in] ite iterator defining the end of the range of surfels.
+  * @param[in] result output iterator of results of the computation.
+  * @param[out] nbEvaluations the number of predicate evaluations.
+  * @return the updated output iterator after all outputs.
+  */
+  template <typename OutputIterator, typename SurfelConstIterator>
+  OutputIterator evalRange( SurfelConstIterator itb,
+                            SurfelConstIterator ite,
+                            OutputIterator result,
+                            std::size_t& nbEvaluations ) const;
+
+  /**
+  * Merges a digital set computed for radius \a i into a multi-radii
+  * kernel.
+  *
+  * @param[in,out] kernel the merged kernel (sorted by points).
+  * @param[in] points the sorted points of the set.
+  * @param[in] i the index of the radius.
+  */
+  static void merge( MultiKernel& kernel, const std::vector< Point >& points,
+                     std::size_t i );
+
+}; // end of class IntegralInvariantMultiScaleEstimator
+
+  /**
+  * Overloads 'operator<<' for displaying objects of class 'IntegralInvariantMultiScaleEstimator'.
+  * @param out the output stream where the object is written.
+  * @param object the object of class 'IntegralInvariantMultiScaleEstimator' to write.
+  * @return the output stream after the writing.
+  */
+  template <typename TKSpace, typename TPointPredicate, typename TFunctor>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const IntegralInvariantMultiScaleEstimator<TKSpace, TPointPredicate, TFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantMultiScaleEstimator.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined IntegralInvariantMultiScaleEstimator_h
+
+#undef IntegralInvariantMultiScaleEstimator_RECURSES
+#endif // else defined(IntegralInvariantMultiScaleEstimator_RECURSES)
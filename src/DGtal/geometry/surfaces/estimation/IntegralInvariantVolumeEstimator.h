@@ -45,6 +45,7 @@
 // Inclusions
 #include <iostream>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelFor.h"
 
 #include "DGtal/kernel/BasicPointFunctors.h"
 #include "DGtal/kernel/CPointPredicate.h"
@@ -60,6 +61,7 @@
 #include "DGtal/shapes/EuclideanShapesDecorator.h"
 
 #include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/images/SummedVolumeTable.h"
 //////////////////////////////////////////////////////////////////////////////
 
 
@@ -84,7 +86,15 @@ namespace DGtal
 * radius.  Experimental results confirm the multigrid convergence.
 *
 * Optimization is available when we give a range of 0-adjacent
-* surfels to the estimator. Note that you should use
+* surfels to the estimator. Alternatively, the kernel strategy
+* SUMMED_VOLUME_TABLE (see setKernelStrategy) precomputes a summed
+* volume table of the shape and a decomposition of the digital ball
+* into boxes, so that each volume is obtained with O(#boxes) lookups
+* instead of O(r^d) predicate evaluations. It is much faster for big
+* radii (or when sweeping several radii, since the table is kept
+* until the next call to attach), at the price of one integer per
+* point of the domain. Both strategies give exactly the same results.
+* Note that you should use
 * IntegralInvariantCovarianceEstimator instead when trying to estimate
 * the normal or principal curvature directions, the Gaussian curvature
 * or individual principal curvature values.
@@ -162,6 +172,19 @@ public:
   BOOST_STATIC_ASSERT (( concepts::ConceptUtils::SameType< typename Convolver::Quantity, 
                                                  typename VolumeFunctor::Argument >::value ));
 
+  /// The summed volume table used by the SUMMED_VOLUME_TABLE strategy.
+  typedef SummedVolumeTable< Domain > VolumeTable;
+  /// A box of the decomposition of the digital kernel.
+  typedef typename VolumeTable::Box KernelBox;
+
+  /// The possible strategies to compute the volume of the
+  /// intersection of the kernel with the shape.
+  enum KernelStrategy
+    {
+      MOVING_KERNEL,      ///< iterates over kernel spels, reusing the result of the previous 0-adjacent surfel (default).
+      SUMMED_VOLUME_TABLE ///< sums the shape points within the boxes of the kernel with a summed volume table.
+    };
+
 
   // ----------------------- Standard services ------------------------------
 public:
@@ -233,6 +256,17 @@ public:
   * @param[in] dRadius the "digital" radius of the kernel (buy may be non integer).
   */
   void setParams( const double dRadius );
+
+  /**
+  * Chooses how volumes are computed. Must be called before init.
+  *
+  * @param[in] aStrategy either MOVING_KERNEL (default) or
+  * SUMMED_VOLUME_TABLE.
+  */
+  void setKernelStrategy( KernelStrategy aStrategy );
+
+  /// @return the strategy used to compute volumes.
+  KernelStrategy kernelStrategy() const;
   
   /**
   * Model of CDigitalSurfaceLocalEstimator. Initialisation.
@@ -288,6 +322,42 @@ public:
                        SurfelConstIterator ite,
                        OutputIterator result ) const;
 
+  /**
+  * -- Estimation --
+  *
+  * Multi-threaded version of eval( itb, ite, result ). The range
+  * [itb,ite) is split into \a nbThreads contiguous chunks, each one
+  * being processed by its own thread with its own convolution state,
+  * so that the optimization on 0-adjacent surfels still applies
+  * within each chunk. Results are output in the same order as the
+  * range [itb,ite) and are identical to the ones of the serial
+  * version.
+  *
+  * @note The point predicate must support concurrent (read-only)
+  * queries, which is the case of images and digitized shapes.
+  *
+  * @tparam OutputIterator type of Iterator of an array of Quantity
+  * @tparam SurfelConstIterator type of (forward) Iterator on a Surfel
+  *
+  * @param[in] itb iterator defining the start of the range of surfels
+  * where we wish to compute some geometric information.
+  *
+  * @param[in] ite iterator defining the end of the range of surfels
+  * where we wish to compute some geometric information.
+  *
+  * @param[in] result output iterator of results of the computation.
+  *
+  * @param[in] nbThreads the number of threads (0 means as many as
+  * the hardware supports, 1 is the serial version).
+  *
+  * @return the updated output iterator after all outputs.
+  */
+  template <typename OutputIterator, typename SurfelConstIterator>
+  OutputIterator eval( SurfelConstIterator itb,
+                       SurfelConstIterator ite,
+                       OutputIterator result,
+                       unsigned int nbThreads ) const;
+
   /**
   * Writes/Displays the object on an output stream.
   * @param out the output stream where the object is written.
@@ -316,9 +386,21 @@ private:
   CountedPtr<Convolver>          myConvolver;   ///< Convolver
   Scalar myH;                               ///< precision of the grid
   Scalar myRadius;                          ///< "digital" radius of the kernel (buy may be non integer).
+  KernelStrategy myStrategy;                ///< the strategy used to compute volumes.
+  CountedConstPtrOrConstPtr<KSpace> myKSpace;   ///< Smart pointer (if required) on the cellular space.
+  CountedPtr<VolumeTable>        myVolumeTable; ///< Summed volume table of the shape (SUMMED_VOLUME_TABLE strategy).
+  std::vector< KernelBox >       myKernelBoxes; ///< Decomposition of the digital kernel into boxes (SUMMED_VOLUME_TABLE strategy).
 
 private:
 
+  /**
+  * Computes the volume at surfel \a s with the summed volume table.
+  * @param[in] s any surfel.
+  * @return the mean of the volumes of the kernel centered on the
+  * inner and outer spels of \a s intersected with the shape.
+  */
+  typename Convolver::Quantity tableVolume( const Surfel& s ) const;
+
 
 }; // end of class IntegralInvariantVolumeEstimator
 
@@ -182,10 +182,14 @@ namespace DGtal
      * @param[in] aMetric an instance of the metric.
      *
      * @param[in] verbose if 'true' displays information on ongoing computation.
+     *
+     * @param[in] aPolicy the execution policy of the VCM computation
+     * (see VoronoiCovarianceMeasureOnDigitalSurface).
      */
     void setParams( Surfel2PointEmbedding surfelEmbedding,
                     const Scalar R, const Scalar r, KernelFunction chi_r,
-                    const Scalar t = 2.5, Metric aMetric = Metric(), bool verbose = true );
+                    const Scalar t = 2.5, Metric aMetric = Metric(), bool verbose = true,
+                    ParallelExecutionPolicy const & aPolicy = ParallelExecutionPolicy() );
 
     /**
      * Model of CDigitalSurfaceLocalEstimator. Initialisation.  Only
@@ -156,13 +156,20 @@ namespace DGtal
      * @param aMetric an instance of the metric (used for the Voronoi map construction).
      *
      * @param verbose if 'true' displays information on ongoing computation.
+     *
+     * @param aPolicy the execution policy: the VCM is computed as
+     * specified in VoronoiCovarianceMeasure, then the convolved VCM of
+     * points and the normals of surfels are computed by ranges
+     * distributed among threads (serial by default).
      */
     VoronoiCovarianceMeasureOnDigitalSurface( ConstAlias< Surface > _surface, 
                                               Surfel2PointEmbedding _surfelEmbedding,
                                               Scalar _R, Scalar _r, 
                                               KernelFunction chi_r,
                                               Scalar t = 2.5, Metric aMetric = Metric(), 
-                                              bool verbose = false );
+                                              bool verbose = false,
+                                              ParallelExecutionPolicy const & aPolicy
+                                                = ParallelExecutionPolicy() );
 
     /// the const-aliased digital surface.
     CountedConstPtrOrConstPtr< Surface > surface() const;
@@ -0,0 +1,138 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CPointProximityStructure.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for concept CPointProximityStructure.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CPointProximityStructure_RECURSES)
+#error Recursive header files inclusion detected in CPointProximityStructure.h
+#else // defined(CPointProximityStructure_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CPointProximityStructure_RECURSES
+
+#if !defined CPointProximityStructure_h
+/** Prevents repeated inclusion of headers. */
+#define CPointProximityStructure_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+ namespace concepts
+ {
+  /////////////////////////////////////////////////////////////////////////////
+  // class CPointProximityStructure
+  /**
+     Description of \b concept '\b CPointProximityStructure' <p>
+     @ingroup Concepts
+     @brief Aim: This concept gathers the data structures that store
+     a static range of digital points and answer proximity queries on
+     them, i.e. give the points lying in a given rectangular box. A
+     point is designated by its index in the range given at
+     initialization, so that users may associate data to points in a
+     simple array (e.g. VoronoiCovarianceMeasure).
+
+     # Refinement of default constructible, copy constructible, assignable
+
+     # Associated types
+     - Point : type of digital points
+     - Size : type of indices of points
+     - Coordinate : type of the coordinates of points
+
+     # Notation
+     - \e X : A type that is a model of CPointProximityStructure
+     - \e x : object of type X
+     - \e p, \e lo, \e up : objects of type Point
+     - \e i : object of type Size
+     - \e itb, \e ite : forward iterators on points
+     - \e v : object of type std::vector<Size>
+     - \e vv : object of type std::vector< std::vector<Size> >
+     - \e c : object of type std::vector<Point>
+     - \e r : object of type Coordinate
+
+     # Valid expressions and semantics
+
+     | Name          | Expression                    | Type requirements | Return type | Precondition | Semantics                                                                  | Post condition | Complexity      |
+     |---------------+-------------------------------+-------------------+-------------+--------------+----------------------------------------------------------------------------+----------------+-----------------|
+     | initialization | x.init( itb, ite )           |                   |             |              | stores the points of [itb,ite), the i-th one having index i               |                | model-dependant |
+     | size          | x.size()                      |                   | Size        |              | the number of stored points                                                |                | O(1)            |
+     | point         | x.point( i )                  |                   | Point       | i < size()   | the point of index i                                                       |                | O(1)            |
+     | box query     | x.getIndicesInBox( v, lo, up ) |                  |             |              | pushes back in \e v the indices of the points \e p with lo <= p <= up     |                | model-dependant |
+     | batched query | x.getIndicesInBoxes( vv, c, r ) |                 |             |              | \e vv[i] is the result of the box query [c[i]-r, c[i]+r]                  |                | model-dependant |
+
+     # Models
+
+     PointKDTree.
+
+     @tparam T the type that should be a model of CPointProximityStructure.
+  */
+  template <typename T>
+  struct CPointProximityStructure
+    : boost::DefaultConstructible<T>, boost::CopyConstructible<T>, boost::Assignable<T>
+  {
+    // ----------------------- Concept checks ------------------------------
+  public:
+    typedef typename T::Point Point;
+    typedef typename T::Size  Size;
+    typedef typename T::Coordinate Coordinate;
+
+    BOOST_CONCEPT_USAGE( CPointProximityStructure )
+    {
+      myX.init( myPoints.begin(), myPoints.end() );
+      checkConstConstraints();
+    }
+    void checkConstConstraints() const
+    {
+      concepts::ConceptUtils::sameType( mySize, myX.size() );
+      concepts::ConceptUtils::sameType( myP, myX.point( mySize ) );
+      myX.getIndicesInBox( myIndices, myP, myP );
+      myX.getIndicesInBoxes( myBatch, myPoints, myCoordinate );
+    }
+    // ------------------------- Private Datas --------------------------------
+  private:
+    T myX;
+    Point myP;
+    Size mySize;
+    std::vector<Point> myPoints;
+    Coordinate myCoordinate;
+    mutable std::vector<Size> myIndices;
+    mutable std::vector< std::vector<Size> > myBatch;
+
+  }; // end of concept CPointProximityStructure
+ }
+} // namespace DGtal
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CPointProximityStructure_h
+
+#undef CPointProximityStructure_RECURSES
+#endif // else defined(CPointProximityStructure_RECURSES)
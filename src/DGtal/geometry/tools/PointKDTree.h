@@ -0,0 +1,240 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PointKDTree.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module PointKDTree.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PointKDTree_RECURSES)
+#error Recursive header files inclusion detected in PointKDTree.h
+#else // defined(PointKDTree_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PointKDTree_RECURSES
+
+#if !defined PointKDTree_h
+/** Prevents repeated inclusion of headers. */
+#define PointKDTree_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CSpace.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PointKDTree
+  /**
+     Description of template class 'PointKDTree' <p> \brief Aim: A
+     static kd-tree on a range of digital points, which answers
+     proximity queries (the points within a rectangular box). It is a
+     model of concepts::CPointProximityStructure and may replace
+     SpatialCubicalSubdivision when the density of points is far from
+     uniform.
+
+     The tree is built once by median splits along the largest extent
+     of the points, until nodes have at most leafSize() points. The
+     nodes are stored in breadth-first order in one array, each with
+     its bounding box, and the points are copied in the order of the
+     leaves, so that a query scans contiguous memory. A point is
+     designated by its index in the range given to init.
+
+     @code
+     PointKDTree< Z3i::Space > tree( points.begin(), points.end() );
+     std::vector< PointKDTree< Z3i::Space >::Size > indices;
+     tree.getIndicesInBox( indices, p - Point::diagonal( 3 ), p + Point::diagonal( 3 ) );
+     @endcode
+
+     @tparam TSpace the digital space, a model of CSpace.
+
+     Model of CopyConstructible, Assignable.
+   */
+  template <typename TSpace>
+  class PointKDTree
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
+  public:
+    typedef TSpace Space;
+    typedef typename Space::Point Point;
+    typedef typename Point::Coordinate Coordinate;
+    typedef std::size_t Size;
+    static const Dimension dimension = Space::dimension;
+
+    /// A node of the tree, i.e. a range of points in leaf order.
+    struct Node {
+      Point lo;         ///< the lowest point of the bounding box of the points of the node.
+      Point up;         ///< the uppermost point of the bounding box of the points of the node.
+      Size begin;       ///< the first point of the node (in leaf order).
+      Size end;         ///< after the last point of the node (in leaf order).
+      Size child;       ///< the index of the first child (the second follows), 0 for a leaf.
+      Dimension axis;   ///< the axis of the split.
+      Coordinate split; ///< points of the second child have a coordinate \a axis >= split.
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor of an empty tree.
+       @param leafSize the maximal number of points of a leaf.
+    */
+    PointKDTree( Size leafSize = 16 );
+
+    /**
+       Constructor from a range of points.
+       @tparam PointIterator a forward iterator on points.
+       @param itb an iterator pointing at the beginning of the range.
+       @param ite an iterator pointing after the end of the range.
+       @param leafSize the maximal number of points of a leaf.
+    */
+    template <typename PointIterator>
+    PointKDTree( PointIterator itb, PointIterator ite, Size leafSize = 16 );
+
+    /**
+       Stores the points of [itb,ite) and builds the tree. The i-th
+       point of the range has index i (duplicated points are kept).
+       @tparam PointIterator a forward iterator on points.
+       @param itb an iterator pointing at the beginning of the range.
+       @param ite an iterator pointing after the end of the range.
+    */
+    template <typename PointIterator>
+    void init( PointIterator itb, PointIterator ite );
+
+    /// @return the number of stored points.
+    Size size() const;
+
+    /// @return 'true' iff there is no point.
+    bool empty() const;
+
+    /// @param i any index smaller than size(). @return the point of index \a i.
+    const Point& point( Size i ) const;
+
+    /// @return the maximal number of points of a leaf.
+    Size leafSize() const;
+
+    /// @return the nodes of the tree, the root being the first one.
+    const std::vector<Node>& nodes() const;
+
+    /**
+       Pushes back in \a indices the indices of the points lying in
+       the box [\a lo, \a up] (bounds included), in leaf order.
+       @param[out] indices the vector where indices are pushed back for output.
+       @param lo the lowest point of the box.
+       @param up the uppermost point of the box.
+    */
+    void getIndicesInBox( std::vector<Size> & indices,
+                          const Point & lo, const Point & up ) const;
+
+    /**
+       Batched query: for each point \a c of \a centers, gets in \a
+       result the indices of the points lying in the box [\a c - \a
+       radius, \a c + \a radius]. The queries are processed in the
+       order of the leaves of their centers, so that successive
+       queries visit the same nodes.
+       @param[out] result the output, one vector of indices per center (in the order of \a centers).
+       @param centers the centers of the queries.
+       @param radius the half edge size of the boxes.
+    */
+    void getIndicesInBoxes( std::vector< std::vector<Size> > & result,
+                            const std::vector<Point> & centers,
+                            Coordinate radius ) const;
+
+    /**
+       @param p any point.
+       @return the index of the leaf whose region contains \a p (following the splits).
+    */
+    Size leaf( const Point & p ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// the maximal number of points of a leaf.
+    Size myLeafSize;
+    /// the points in the order of the input range.
+    std::vector<Point> myPoints;
+    /// the points in leaf order.
+    std::vector<Point> myTreePoints;
+    /// the index of each point in leaf order.
+    std::vector<Size> myIndices;
+    /// the nodes, in breadth-first order.
+    std::vector<Node> myNodes;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Builds the tree from myPoints.
+    void build();
+
+    /**
+       @param begin the first point of the node (in leaf order).
+       @param end after the last point of the node.
+       @return a leaf node with its bounding box.
+    */
+    Node makeNode( Size begin, Size end ) const;
+
+  }; // end of class PointKDTree
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PointKDTree'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PointKDTree' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const PointKDTree<TSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/tools/PointKDTree.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PointKDTree_h
+
+#undef PointKDTree_RECURSES
+#endif // else defined(PointKDTree_RECURSES)
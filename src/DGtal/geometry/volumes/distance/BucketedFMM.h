@@ -0,0 +1,425 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BucketedFMM.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module BucketedFMM.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BucketedFMM_RECURSES)
+#error Recursive header files inclusion detected in BucketedFMM.h
+#else // defined(BucketedFMM_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BucketedFMM_RECURSES
+
+#if !defined BucketedFMM_h
+/** Prevents repeated inclusion of headers. */
+#define BucketedFMM_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <vector>
+#include <boost/type_traits/is_floating_point.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ParallelFor.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BucketedFMM
+  /**
+   * Description of template class 'BucketedFMM' <p>
+   * \brief Aim: Fast Marching Method for nd distance transforms on a
+   * hyper-rectangular domain, with flat array storage and a bucketed
+   * priority queue.
+   *
+   * This is an alternative engine to FMM with the L2 first-order
+   * local distance (L2FirstOrderLocalDistance), for the common case
+   * where the computation takes place in a HyperRectDomain:
+   *
+   * - distance values and point states (far, candidate, accepted,
+   *   outside the point predicate) are stored in flat arrays indexed
+   *   by the linearized points, instead of a map-based image and set;
+   *
+   * - candidates are ordered by an untidy priority queue: an array of
+   *   buckets of width \a h (the bucket width) in absolute distance
+   *   value. Insertion is in O(1) and each point is extracted in O(1)
+   *   amortized (buckets are sorted when they are extracted, but
+   *   candidates inserted in the current bucket are accepted after
+   *   it). The accepted values may thus differ from the ones of FMM by
+   *   O(h); they are the same when \a h tends to zero.
+   *
+   * Like FMM, the propagation stops above a value threshold (narrow
+   * band) or an area threshold, and signed distances are supported:
+   * the sign of a new point is the one of its neighbor of least
+   * absolute value.
+   *
+   * As an alternative to marching, computeBySweeping() solves the same
+   * discrete (upwind) equation by the fast sweeping method on blocks
+   * of slices, processed in parallel in a red-black order, so that the
+   * result does not depend on the number of threads. Since the
+   * solution is the one of the exact (tidy) marching, it is also a
+   * reference for the bucketed queue.
+   *
+   * @code
+   * typedef BucketedFMM< Z3i::Space, Z3i::Domain::Predicate > FastMarching;
+   * FastMarching fmm( domain, domain.predicate(), 1000000, 5.0 );
+   * fmm.initFromIncidentPointsRange( pairs.begin(), pairs.end(), 0.5 );
+   * fmm.compute();                 // or fmm.computeBySweeping( ParallelExecutionPolicy( 0 ) );
+   * fmm.copyTo( image, set );      // e.g. the image and set of a FMM
+   * @endcode
+   *
+   * @tparam TSpace a model of CSpace, the domain being
+   * HyperRectDomain<TSpace>.
+   * @tparam TPointPredicate any model of concepts::CPointPredicate,
+   * used to bound the computation within the domain.
+   * @tparam TValue the floating-point type of distance values.
+   *
+   * @see FMM
+   * @see testBucketedFMM.cpp
+   */
+  template < typename TSpace, typename TPointPredicate, typename TValue = double >
+  class BucketedFMM
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate<TPointPredicate> ));
+    BOOST_STATIC_ASSERT(( boost::is_floating_point< TValue >::value ));
+
+    typedef BucketedFMM< TSpace, TPointPredicate, TValue > Self;
+    typedef TSpace                          Space;
+    typedef HyperRectDomain< Space >        Domain;
+    typedef TPointPredicate                 PointPredicate;
+    typedef TValue                          Value;
+    typedef typename Space::Point           Point;
+    typedef typename Space::Vector          Vector;
+    typedef typename Space::Dimension       Dimension;
+    typedef typename Space::Size            Size;
+    typedef typename Point::Coordinate      Coordinate;
+    typedef DGtal::uint64_t                 Area;
+    static const Dimension dimension = Space::dimension;
+
+    BOOST_STATIC_ASSERT(( boost::is_same< Point, typename PointPredicate::Point >::value ));
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aDomain the domain of the computation.
+     * @param aPointPredicate a point predicate that returns 'true'
+     * inside the region where the distance is computed.
+     * @param aAreaThreshold the number of accepted points above which
+     * the propagation stops.
+     * @param aValueThreshold the absolute distance value above which
+     * the propagation stops.
+     * @param aBucketWidth the width of the buckets of the queue.
+     */
+    BucketedFMM( ConstAlias<Domain> aDomain,
+                 ConstAlias<PointPredicate> aPointPredicate,
+                 const Area & aAreaThreshold = std::numeric_limits<Area>::max(),
+                 const Value & aValueThreshold = std::numeric_limits<Value>::max(),
+                 const Value & aBucketWidth = Value( 1 ) / Value( 16 ) );
+
+    /**
+     * Destructor.
+     */
+    ~BucketedFMM() = default;
+
+    /**
+     * Deleted copy constructor.
+     * @param other the object to clone.
+     */
+    BucketedFMM( const Self & other ) = delete;
+
+    /**
+     * Deleted assignment operator.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    Self & operator=( const Self & other ) = delete;
+
+    // ----------------------- Initialization ---------------------------------
+  public:
+
+    /**
+     * Sets the value of a point, which becomes accepted. The initial
+     * points must be set before computing.
+     *
+     * @param aPoint a point of the domain.
+     * @param aValue its (signed) distance value.
+     */
+    void setAccepted( const Point & aPoint, const Value & aValue );
+
+    /**
+     * Sets the value of the points of the range [@a itb , @a ite ) to
+     * @a aValue.
+     *
+     * @param itb begin iterator (on points)
+     * @param ite end iterator (on points)
+     * @param aValue distance value
+     */
+    template <typename TIteratorOnPoints>
+    void initFromPointsRange( const TIteratorOnPoints & itb,
+                              const TIteratorOnPoints & ite,
+                              const Value & aValue );
+
+    /**
+     * Sets the value of the inner and outer points of the range
+     * [@a itb , @a ite ) of pairs of points, as
+     * FMM::initFromIncidentPointsRange: the inner points get - @a
+     * aValue if @a aFlagIsPositive is 'true' (default) but @a aValue
+     * otherwise, and conversely for the outer points.
+     *
+     * @param itb begin iterator (on pairs of points)
+     * @param ite end iterator (on pairs of points)
+     * @param aValue distance value
+     * @param aFlagIsPositive The flag controlling the \a aValue sign
+     * assigned to inner points.
+     */
+    template <typename TIteratorOnPairs>
+    void initFromIncidentPointsRange( const TIteratorOnPairs & itb,
+                                      const TIteratorOnPairs & ite,
+                                      const Value & aValue,
+                                      bool aFlagIsPositive = true );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Computation of the signed distance function by marching out
+     * from the accepted points, with the bucketed queue.
+     */
+    void compute();
+
+    /**
+     * Computation of the signed distance function by the fast
+     * sweeping method. The domain is cut into blocks of @a
+     * aBlockSize slices along the last dimension. Each iteration
+     * processes the even blocks in parallel, then the odd ones, each
+     * block being swept in the 2^n directions. Iterations stop when
+     * no value decreases. The values below the value threshold are
+     * the ones of the exact (tidy) marching, whatever the number of
+     * threads; the area threshold is not used.
+     *
+     * @note the point predicate must support concurrent calls.
+     *
+     * @param aPolicy the execution policy.
+     * @param aBlockSize the number of slices of a block.
+     * @return the number of iterations.
+     */
+    Size computeBySweeping( const ParallelExecutionPolicy & aPolicy = ParallelExecutionPolicy(),
+                            Size aBlockSize = 8 );
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return its distance value if it is accepted, infinity otherwise.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return 'true' if the point is accepted, 'false' otherwise.
+     */
+    bool isAccepted( const Point & aPoint ) const;
+
+    /**
+     * Copies the accepted points and their values, e.g. into the image
+     * and the set of accepted points of a FMM.
+     *
+     * @tparam TImage a model of concepts::CImage on Point and Value.
+     * @tparam TSet a model of concepts::CDigitalSet on Point.
+     * @param aImage the output image.
+     * @param aSet the output set.
+     */
+    template <typename TImage, typename TSet>
+    void copyTo( TImage & aImage, TSet & aSet ) const;
+
+    /**
+     * @return the number of accepted points.
+     */
+    Area nbAccepted() const;
+
+    /**
+     * Minimal distance value in the set of accepted points.
+     * @return minimal distance value.
+     */
+    Value min() const;
+
+    /**
+     * Maximal distance value in the set of accepted points.
+     * @return maximal distance value.
+     */
+    Value max() const;
+
+    /**
+     * @return the domain of the computation.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the width of the buckets of the queue.
+     */
+    Value bucketWidth() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// States of the points.
+    enum State { UNVISITED = 0, CANDIDATE = 1, ACCEPTED = 2, OUTSIDE = 3 };
+
+    /// Pointer on the domain.
+    const Domain * myDomainPtr;
+    /// Pointer on the point predicate.
+    const PointPredicate * myPointPredicatePtr;
+    /// Area threshold (in number of accepted points).
+    Area myAreaThreshold;
+    /// Value threshold.
+    Value myValueThreshold;
+    /// Width of the buckets.
+    Value myBucketWidth;
+    /// Lowest point of the domain.
+    Point myLower;
+    /// Extent of the domain.
+    Vector myExtent;
+    /// Offset between the indices of two neighbors along each dimension.
+    std::vector< Size > myStrides;
+    /// Distance values, indexed by linearized points.
+    std::vector< Value > myValues;
+    /// States, indexed by linearized points.
+    std::vector< unsigned char > myStates;
+    /// Indices of the accepted points given at initialization.
+    std::vector< Size > mySeeds;
+    /// Buckets of candidate indices (with possible duplicates).
+    std::vector< std::vector< Size > > myBuckets;
+    /// Number of accepted points.
+    Area myNbAccepted;
+    /// Min value.
+    Value myMinValue;
+    /// Max value.
+    Value myMaxValue;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return its index.
+     */
+    Size index( const Point & aPoint ) const;
+
+    /**
+     * @param anIndex an index.
+     * @return the point of index @a anIndex.
+     */
+    Point point( Size anIndex ) const;
+
+    /**
+     * Marks a point as accepted with the given value.
+     * @param anIndex the index of the point.
+     * @param aValue its value.
+     */
+    void accept( Size anIndex, const Value & aValue );
+
+    /**
+     * Updates the candidates among the neighbors of an accepted point.
+     * @param anIndex the index of the accepted point.
+     * @param aCurrentBucket the bucket being extracted.
+     */
+    void updateNeighbors( Size anIndex, Size aCurrentBucket );
+
+    /**
+     * Computes (or lowers) the tentative value of a candidate point.
+     * @param anIndex the index of the point.
+     * @param aPoint the point.
+     * @param aCurrentBucket the bucket being extracted.
+     */
+    void updateCandidate( Size anIndex, const Point & aPoint, Size aCurrentBucket );
+
+    /**
+     * Computes the L2 first-order local distance of a point from the
+     * values of its neighbors, as L2FirstOrderLocalDistance.
+     *
+     * @param anIndex the index of the point.
+     * @param aPoint the point.
+     * @param acceptedOnly when 'true', only accepted neighbors are
+     * used, otherwise any neighbor with a finite value.
+     * @return the new value, or infinity if no neighbor is used.
+     */
+    Value localValue( Size anIndex, const Point & aPoint, bool acceptedOnly ) const;
+
+    /**
+     * Sweeps a block in one of the 2^n directions.
+     * @param lo the lowest point of the block.
+     * @param hi the uppermost point of the block.
+     * @param aDirections the i-th bit is 1 for a decreasing coordinate i.
+     * @return 'true' if some value has decreased.
+     */
+    bool sweepBlock( const Point & lo, const Point & hi, unsigned int aDirections );
+
+  }; // end of class BucketedFMM
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BucketedFMM'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BucketedFMM' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TSpace, typename TPointPredicate, typename TValue >
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const BucketedFMM< TSpace, TPointPredicate, TValue > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/BucketedFMM.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BucketedFMM_h
+
+#undef BucketedFMM_RECURSES
+#endif // else defined(BucketedFMM_RECURSES)
@@ -125,9 +125,9 @@ namespace DGtal
                          typename SeparableMetric::Point>::value));
 
     ///Definition of the image.
-    typedef  DistanceTransformation<TSpace,TPointPredicate,TSeparableMetric> Self;
+    typedef  DistanceTransformation<TSpace,TPointPredicate,TSeparableMetric,TImageContainer> Self;
 
-    typedef VoronoiMap<TSpace,TPointPredicate,TSeparableMetric> Parent;
+    typedef VoronoiMap<TSpace,TPointPredicate,TSeparableMetric,TImageContainer> Parent;
 
     ///Definition of the image constRange
     typedef  DefaultConstImageRange<Self> ConstRange;
@@ -140,29 +140,35 @@ namespace DGtal
     /**
      *  Constructor in the non-periodic case.
      *
-     * See documentation of VoronoiMap constructor.
+     * See documentation of VoronoiMap constructor (\a aPolicy is the
+     * execution policy of the separable passes, serial by default).
      */
     DistanceTransformation(ConstAlias<Domain> aDomain,
                            ConstAlias<PointPredicate> predicate,
-                           ConstAlias<SeparableMetric> aMetric):
+                           ConstAlias<SeparableMetric> aMetric,
+                           ParallelExecutionPolicy const & aPolicy = ParallelExecutionPolicy()):
       VoronoiMap<TSpace,TPointPredicate,TSeparableMetric,TImageContainer>(aDomain,
                                                                           predicate,
-                                                                          aMetric)
+                                                                          aMetric,
+                                                                          aPolicy)
     {}
 
     /**
      *  Constructor with periodicity specification.
      *
-     * See documentation of VoronoiMap constructor.
+     * See documentation of VoronoiMap constructor (\a aPolicy is the
+     * execution policy of the separable passes, serial by default).
      */
     DistanceTransformation(ConstAlias<Domain> aDomain,
                            ConstAlias<PointPredicate> predicate,
                            ConstAlias<SeparableMetric> aMetric,
-                           typename Parent::PeriodicitySpec const & aPeriodicitySpec)
+                           typename Parent::PeriodicitySpec const & aPeriodicitySpec,
+                           ParallelExecutionPolicy const & aPolicy = ParallelExecutionPolicy())
       : VoronoiMap<TSpace,TPointPredicate,TSeparableMetric,TImageContainer>(aDomain,
                                                                             predicate,
                                                                             aMetric,
-                                                                            aPeriodicitySpec)
+                                                                            aPeriodicitySpec,
+                                                                            aPolicy)
     {}
 
     /**
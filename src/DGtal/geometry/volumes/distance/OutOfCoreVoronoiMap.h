@@ -0,0 +1,281 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file OutOfCoreVoronoiMap.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module OutOfCoreVoronoiMap.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(OutOfCoreVoronoiMap_RECURSES)
+#error Recursive header files inclusion detected in OutOfCoreVoronoiMap.h
+#else // defined(OutOfCoreVoronoiMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define OutOfCoreVoronoiMap_RECURSES
+
+#if !defined OutOfCoreVoronoiMap_h
+/** Prevents repeated inclusion of headers. */
+#define OutOfCoreVoronoiMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Alias.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ParallelFor.h"
+#include "DGtal/images/CImageFactory.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+#include "DGtal/geometry/volumes/distance/SeparableSweep.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OutOfCoreVoronoiMap
+  /**
+   * Description of template class 'OutOfCoreVoronoiMap' <p>
+   * \brief Aim: Computes the same Voronoi map as VoronoiMap, but in
+   * an image provided by an image factory (model of
+   * concepts::CImageFactory), with a bounded amount of memory.
+   *
+   * The separable passes are grouped in two phases, each of them
+   * working on slabs of the domain requested from (then flushed to)
+   * the factory, one at a time:
+   *
+   * - slabs cut along the last dimension: initialization of the sites
+   *   from the predicate and passes along dimensions 0 to n-2, which
+   *   stay within a slab;
+   * - slabs cut along dimension n-2 (the first one in 2D): pass
+   *   along dimension n-1.
+   *
+   * The whole image is thus read and written twice. With the usual
+   * (column-major) storage of the factory image, the slabs of the
+   * first phase are contiguous, and the slabs of the second phase are
+   * made of contiguous runs of whole layers along dimensions 0 to n-3.
+   * Slabs are as thick as possible with
+   * at most \a maxSlabSize points, which bounds the memory used by
+   * the computation (in addition to the one of the factory).
+   *
+   * The map is not stored by this object: once computed, it is read
+   * through the factory (e.g. with a TiledImage or with the image of
+   * an ImageFactoryFromImage / ImageFactoryFromHDF5). The value of
+   * the distance transformation at a point p is then
+   * `distance( p, site )`, where site is the value of the map at p.
+   *
+   * @code
+   * typedef ImageContainerBySTLVector< Z3i::Domain, Z3i::Vector > Image;
+   * typedef ImageFactoryFromHDF5< Image >                          Factory;
+   * Factory factory( filename, "/voronoi" );
+   * OutOfCoreVoronoiMap< Z3i::Space, Predicate, Z3i::L2Metric, Factory >
+   *   voronoi( domain, predicate, Z3i::l2Metric, factory, 1 << 24 );
+   * @endcode
+   *
+   * @tparam TSpace type of Digital Space (model of CSpace).
+   * @tparam TPointPredicate point predicate returning true for points
+   * from which we compute the distance (model of CPointPredicate).
+   * @tparam TSeparableMetric a model of CSeparableMetric.
+   * @tparam TImageFactory a model of CImageFactory whose domain is the
+   * HyperRectDomain of TSpace and whose images store TSpace::Vector.
+   *
+   * @see testOutOfCoreVoronoiMap.cpp
+   */
+  template < typename TSpace,
+             typename TPointPredicate,
+             typename TSeparableMetric,
+             typename TImageFactory >
+  class OutOfCoreVoronoiMap
+    : private VoronoiMap< TSpace, TPointPredicate, TSeparableMetric >
+  {
+  public:
+    BOOST_CONCEPT_ASSERT(( concepts::CImageFactory< TImageFactory > ));
+
+    typedef VoronoiMap< TSpace, TPointPredicate, TSeparableMetric > Parent;
+    typedef OutOfCoreVoronoiMap< TSpace, TPointPredicate,
+                                 TSeparableMetric, TImageFactory > Self;
+    typedef TImageFactory                         ImageFactory;
+    typedef typename ImageFactory::OutputImage    FactoryImage;
+    typedef typename Parent::Space                Space;
+    typedef typename Parent::Point                Point;
+    typedef typename Parent::Vector               Vector;
+    typedef typename Parent::Value                Value;
+    typedef typename Parent::Dimension            Dimension;
+    typedef typename Parent::Size                 Size;
+    typedef typename Parent::Domain               Domain;
+    typedef typename Parent::PointPredicate       PointPredicate;
+    typedef typename Parent::SeparableMetric      SeparableMetric;
+    typedef typename Parent::PeriodicitySpec      PeriodicitySpec;
+    typedef typename SeparableMetric::Value       Distance;
+
+    BOOST_STATIC_ASSERT(( boost::is_same< typename ImageFactory::Domain, Domain >::value ));
+    BOOST_STATIC_ASSERT(( boost::is_same< typename FactoryImage::Value, Vector >::value ));
+
+    using Parent::domain;
+    using Parent::metric;
+    using Parent::isPeriodic;
+    using Parent::getPeriodicitySpec;
+    using Parent::projectPoint;
+    using Parent::policy;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Computes the Voronoi map into the image of the
+     * factory.
+     *
+     * @param aDomain a pointer to the (hyper-rectangular) domain on
+     * which the computation is performed (the domain of the factory).
+     * @param predicate a pointer to the point predicate to define the
+     * Voronoi sites (false points).
+     * @param aMetric a pointer to the separable metric instance.
+     * @param aFactory the image factory where the map is stored.
+     * @param maxSlabSize the maximal number of points of a slab
+     * (slabs are at least one point thick, and are never cut along
+     * the dimension of their passes, which only matters in dimension 1).
+     * @param aPeriodicitySpec the periodicity along each dimension
+     * (none by default).
+     * @param aPolicy the execution policy of the passes within a slab.
+     */
+    OutOfCoreVoronoiMap( ConstAlias<Domain> aDomain,
+                         ConstAlias<PointPredicate> predicate,
+                         ConstAlias<SeparableMetric> aMetric,
+                         Alias<ImageFactory> aFactory,
+                         Size maxSlabSize,
+                         PeriodicitySpec const & aPeriodicitySpec = PeriodicitySpec(),
+                         ParallelExecutionPolicy const & aPolicy = ParallelExecutionPolicy() );
+
+    /**
+     * Destructor.
+     */
+    ~OutOfCoreVoronoiMap() = default;
+
+    /**
+     * Deleted copy constructor.
+     * @param other the object to clone.
+     */
+    OutOfCoreVoronoiMap( const Self & other ) = delete;
+
+    /**
+     * Deleted assignment operator.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    Self & operator=( const Self & other ) = delete;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the image factory storing the map.
+     */
+    ImageFactory & imageFactory() const;
+
+    /**
+     * @return the maximal number of points of a slab.
+     */
+    Size maxSlabSize() const;
+
+    /**
+     * @return the number of slabs requested from the factory by the
+     * computation.
+     */
+    Size nbSlabs() const;
+
+    /**
+     * @param aPoint a point of the domain.
+     * @param aSite the site associated to @a aPoint by the map.
+     * @return the distance from @a aPoint to @a aSite, i.e. the
+     * distance transformation at @a aPoint.
+     */
+    Distance distance( const Point & aPoint, const Value & aSite ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The point predicate.
+    const PointPredicate * myPredicatePtr;
+    /// The image factory storing the map.
+    ImageFactory * myFactory;
+    /// The maximal number of points of a slab.
+    Size myMaxSlabSize;
+    /// The number of slabs requested from the factory.
+    Size myNbSlabs;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /// Computes the map, slab by slab.
+    void compute();
+
+    /**
+     * Processes the slabs of the domain cut along @a cutDim.
+     * @param cutDim the dimension along which the domain is cut.
+     * @param init when 'true', sites are first initialized from the
+     * predicate.
+     * @param dimBegin the first dimension of the passes.
+     * @param dimEnd the dimension after the last one of the passes.
+     */
+    void computeSlabs( Dimension cutDim, bool init,
+                       Dimension dimBegin, Dimension dimEnd );
+
+  }; // end of class OutOfCoreVoronoiMap
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'OutOfCoreVoronoiMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'OutOfCoreVoronoiMap' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TSpace, typename TPointPredicate,
+             typename TSeparableMetric, typename TImageFactory >
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const OutOfCoreVoronoiMap< TSpace, TPointPredicate,
+                                          TSeparableMetric, TImageFactory > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/OutOfCoreVoronoiMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined OutOfCoreVoronoiMap_h
+
+#undef OutOfCoreVoronoiMap_RECURSES
+#endif // else defined(OutOfCoreVoronoiMap_RECURSES)
@@ -48,6 +48,8 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedPtr.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ParallelFor.h"
+#include "DGtal/geometry/volumes/distance/SeparableSweep.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/images/CConstImage.h"
@@ -176,10 +178,15 @@ namespace DGtal
      * returning the weight for some points
      * @param aMetric a power
      * seprable metric instance.
+     * @param aPolicy the execution policy of the separable passes
+     * (serial by default). With a parallel policy, each 1D sweep is
+     * distributed among threads, by batches of consecutive rows along
+     * the strided dimensions. The result does not depend on the policy.
      */
     PowerMap(ConstAlias<Domain> aDomain,
              ConstAlias<WeightImage> aWeightImage,
-             ConstAlias<PowerSeparableMetric> aMetric);
+             ConstAlias<PowerSeparableMetric> aMetric,
+             ParallelExecutionPolicy const & aPolicy = ParallelExecutionPolicy());
 
     /**
      * Constructor with periodicity specification.
@@ -201,11 +208,14 @@ namespace DGtal
      * @param aPeriodicitySpec an array of size equal to the space dimension
      *        where the i-th value is \c true if the i-th dimension of the
      *        space is periodic, \c false otherwise.
+     * @param aPolicy the execution policy of the separable passes
+     *        (serial by default).
      */
     PowerMap(ConstAlias<Domain> aDomain,
              ConstAlias<WeightImage> aWeightImage,
              ConstAlias<PowerSeparableMetric> aMetric,
-             PeriodicitySpec const & aPeriodicitySpec);
+             PeriodicitySpec const & aPeriodicitySpec,
+             ParallelExecutionPolicy const & aPolicy = ParallelExecutionPolicy());
 
     /**
      * Disable default constructor.
@@ -273,6 +283,14 @@ namespace DGtal
       return myWeightImagePtr;
     }
 
+    /**
+     * @return the execution policy of the separable passes.
+     */
+    ParallelExecutionPolicy const & policy() const
+    {
+      return myPolicy;
+    }
+
     /** Periodicity specification.
      *
      * @returns the periodicity specification array.
@@ -343,6 +361,39 @@ namespace DGtal
     void computeOtherStep1D (const Point &row,
                              const Dimension dim) const;
 
+    /**
+     * Same as computeOtherStep1D( row, dim ), but working on a copy
+     * of the 1D span: the value at the point of coordinate c along
+     * dimension @a dim is `line[ ( c - lowerBound[ dim ] ) * stride ]`.
+     *
+     * @param row starting point of the 1D process.
+     * @param dim dimension of the update.
+     * @param line the values of the map along the 1D span.
+     * @param stride the distance between two consecutive values in @a line.
+     */
+    void computeOtherStep1D (const Point &row,
+                             const Dimension dim,
+                             Point * line,
+                             const std::size_t stride) const;
+
+    /**
+     * 1D process shared by both computeOtherStep1D: reads and writes
+     * the values of the map along the 1D span through @a line, which
+     * is either the output image itself or a StridedLine on a copy of
+     * the span.
+     *
+     * @tparam TLine the type of the line, providing `operator()(const
+     * Point&)` and `setValue(const Point&, const Point&)`.
+     *
+     * @param row starting point of the 1D process.
+     * @param dim dimension of the update.
+     * @param line the values of the map along the 1D span.
+     */
+    template <typename TLine>
+    void computeOtherStep1DOnLine (const Point &row,
+                                   const Dimension dim,
+                                   TLine & line) const;
+
     /**
      * Project point coordinates into the domain, taking into account
      * the periodicity up to a fixed dimension.
@@ -396,6 +447,9 @@ namespace DGtal
     /// Domain extent.
     Point myDomainExtent;
 
+    /// Execution policy of the separable passes.
+    ParallelExecutionPolicy myPolicy;
+
   protected:
     ///Pointer to the separable metric instance
     const PowerSeparableMetric * myMetricPtr;
@@ -46,6 +46,7 @@
 #include <iostream>
 #include <vector>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelFor.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/geometry/volumes/distance/CPowerSeparableMetric.h"
 #include "DGtal/geometry/volumes/distance/PowerMap.h"
@@ -126,6 +127,60 @@ namespace DGtal
 
       return Type( computedMA );
     }
+
+    /**
+     * Extract reduced medial axis from a power map, scanning the
+     * domain by slabs distributed among threads as specified by \a
+     * aPolicy. Balls are inserted in the output container in domain
+     * order, so the result is the same as the serial version.
+     *
+     * @param aPowerMap the input powerMap
+     * @param aPolicy the execution policy.
+     *
+     * @return a lightweight proxy to the ImageContainer specified in
+     * template arguments.
+     */
+    static
+    Type getReducedMedialAxisFromPowerMap(const TPowerMap &aPowerMap,
+                                          const ParallelExecutionPolicy &aPolicy)
+    {
+      if ( aPolicy.isSerial() )
+        return getReducedMedialAxisFromPowerMap( aPowerMap );
+
+      typedef typename TPowerMap::Domain                       Domain;
+      typedef typename TPowerMap::Point                        Point;
+      typedef typename TPowerMap::PowerSeparableMetric::Value  Value;
+      typedef std::vector< std::pair< Point, Value > >         Balls;
+
+      const Domain & domain = aPowerMap.domain();
+      const auto last = Point::dimension - 1;
+      const std::size_t n = domain.upperBound()[ last ] - domain.lowerBound()[ last ] + 1;
+      std::vector< Balls > balls( functions::effectiveNbThreads( aPolicy.nbThreads ) );
+      functions::parallelFor( n, aPolicy.nbThreads,
+        [&] ( unsigned int chunk, std::size_t b, std::size_t e )
+        {
+          Point lo = domain.lowerBound();
+          Point hi = domain.upperBound();
+          lo[ last ] += (typename Point::Coordinate) b;
+          hi[ last ]  = domain.lowerBound()[ last ] + (typename Point::Coordinate) e - 1;
+          const Domain slab( lo, hi );
+          for ( typename Domain::ConstIterator it = slab.begin(), itend = slab.end();
+                it != itend; ++it )
+            {
+              const auto v  = aPowerMap( *it );
+              const auto pv = aPowerMap.projectPoint( v );
+              const Value w = aPowerMap.weightImagePtr()->operator()( pv );
+              if ( aPowerMap.metricPtr()->powerDistance( *it, v, w ) < NumberTraits<Value>::ZERO )
+                balls[ chunk ].push_back( std::make_pair( v, w ) );
+            }
+        } );
+
+      TImageContainer *computedMA = new TImageContainer( domain );
+      for ( const auto & chunkBalls : balls )
+        for ( const auto & ball : chunkBalls )
+          computedMA->setValue( ball.first, ball.second );
+      return Type( computedMA );
+    }
   }; // end of class ReducedMedialAxis
 
 
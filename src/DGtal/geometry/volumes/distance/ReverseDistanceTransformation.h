@@ -137,29 +137,35 @@ namespace DGtal
     /**
      *  Constructor in the non-periodic case.
      *
-     * See documentation of PowerMap constructor.
+     * See documentation of PowerMap constructor (\a aPolicy is the
+     * execution policy of the separable passes, serial by default).
      */
     ReverseDistanceTransformation(ConstAlias<Domain> aDomain,
                                   ConstAlias<WeightImage> aWeightImage,
-                                  ConstAlias<PowerSeparableMetric> aMetric):
+                                  ConstAlias<PowerSeparableMetric> aMetric,
+                                  ParallelExecutionPolicy const & aPolicy = ParallelExecutionPolicy()):
       PowerMap<TWeightImage,TPSeparableMetric,TImageContainer>(aDomain,
                                                                aWeightImage,
-                                                               aMetric)
+                                                               aMetric,
+                                                               aPolicy)
     {}
 
     /**
      *  Constructor with periodicity specification.
      *
-     * See documentation of PowerMap constructor.
+     * See documentation of PowerMap constructor (\a aPolicy is the
+     * execution policy of the separable passes, serial by default).
      */
     ReverseDistanceTransformation(ConstAlias<Domain> aDomain,
                                   ConstAlias<WeightImage> aWeightImage,
                                   ConstAlias<PowerSeparableMetric> aMetric,
-                                  typename Parent::PeriodicitySpec const & aPeriodicitySpec)
+                                  typename Parent::PeriodicitySpec const & aPeriodicitySpec,
+                                  ParallelExecutionPolicy const & aPolicy = ParallelExecutionPolicy())
       : PowerMap<TWeightImage,TPSeparableMetric,TImageContainer>(aDomain,
                                                                  aWeightImage,
                                                                  aMetric,
-                                                                 aPeriodicitySpec)
+                                                                 aPeriodicitySpec,
+                                                                 aPolicy)
     {}
 
     /**
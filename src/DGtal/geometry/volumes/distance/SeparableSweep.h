@@ -0,0 +1,236 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SeparableSweep.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for the parallel line sweeps of separable algorithms.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SeparableSweep_RECURSES)
+#error Recursive header files inclusion detected in SeparableSweep.h
+#else // defined(SeparableSweep_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SeparableSweep_RECURSES
+
+#if !defined SeparableSweep_h
+/** Prevents repeated inclusion of headers. */
+#define SeparableSweep_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <algorithm>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelFor.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /**
+   * Gives an image-like access (operator() and setValue) to a copy of
+   * a 1D span of an image along dimension \a dim, as given by
+   * functions::sweepImageLines: the value at the point of coordinate c
+   * along \a dim is `data[ ( c - lower ) * stride ]`. It lets the 1D
+   * processes of separable algorithms be written once, for images and
+   * for buffers.
+   *
+   * @tparam TPoint the type of point.
+   * @tparam TValue the type of value.
+   */
+  template <typename TPoint, typename TValue>
+  struct StridedLine
+  {
+    typedef typename TPoint::Coordinate Coordinate;
+    typedef typename TPoint::Dimension  Dimension;
+
+    /// First value of the span.
+    TValue * data;
+    /// Distance between two consecutive values of the span.
+    std::size_t stride;
+    /// Coordinate of the first value of the span.
+    Coordinate lower;
+    /// Dimension of the span.
+    Dimension dim;
+
+    /// @return the value at point \a p of the span.
+    TValue operator()( const TPoint& p ) const
+    {
+      return data[ ( p[ dim ] - lower ) * stride ];
+    }
+
+    /// Sets the value at point \a p of the span to \a v.
+    void setValue( const TPoint& p, const TValue& v ) const
+    {
+      data[ ( p[ dim ] - lower ) * stride ] = v;
+    }
+  };
+
+  namespace functions
+  {
+    /**
+     * Executes \a f on slabs of the hyper-rectangle [lower,upper],
+     * cut along the last dimension, in parallel. Used to initialize
+     * images before a separable sweep.
+     *
+     * @tparam TPoint the type of point.
+     * @tparam TFunctor the type of a functor `(const TPoint& lo, const
+     * TPoint& hi) -> void`, called once per slab [lo,hi].
+     *
+     * @param lower the lowest point of the hyper-rectangle.
+     * @param upper the uppermost point of the hyper-rectangle.
+     * @param policy the execution policy.
+     * @param f the functor.
+     */
+    template <typename TPoint, typename TFunctor>
+    void parallelForSlabs( const TPoint& lower, const TPoint& upper,
+                           const ParallelExecutionPolicy& policy, TFunctor f )
+    {
+      const auto last = TPoint::dimension - 1;
+      const std::size_t n = upper[ last ] - lower[ last ] + 1;
+      parallelFor( n, policy.nbThreads,
+                   [&] ( unsigned int, std::size_t b, std::size_t e )
+                   {
+                     TPoint lo = lower;
+                     TPoint hi = upper;
+                     lo[ last ] = lower[ last ] + (typename TPoint::Coordinate) b;
+                     hi[ last ] = lower[ last ] + (typename TPoint::Coordinate) e - 1;
+                     f( lo, hi );
+                   } );
+    }
+
+    /**
+     * Applies a 1D process \a f on every line of the image \a image
+     * along dimension \a dim, restricted to [lower,upper]. Lines are
+     * distributed among threads as specified by \a policy. This is the
+     * core of separable algorithms like VoronoiMap or PowerMap.
+     *
+     * Each line is first copied into a buffer, processed in place by
+     * \a f, then written back. When \a dim is not 0 (i.e. the line is
+     * strided in memory), batches of up to `policy.batchSize`
+     * consecutive lines along dimension 0 are copied together,
+     * interleaved, so that reading and writing the image is done on
+     * contiguous memory (cache blocking). When \a dim is 0, lines are
+     * already contiguous and are processed one by one.
+     *
+     * @note \a f must only access its line through the given buffer,
+     * and the image must support concurrent read/write accesses on
+     * distinct points (which is the case of ImageContainerBySTLVector).
+     *
+     * @tparam TImage a model of concepts::CImage.
+     * @tparam TLineFunctor the type of a functor `(const Point& row,
+     * Value* line, std::size_t stride) -> void`, where the value of the
+     * image at the point of coordinate c along \a dim on the line
+     * starting at \a row is `line[ ( c - lower[ dim ] ) * stride ]`.
+     *
+     * @param image the image.
+     * @param lower the lowest point of the processed part of the image.
+     * @param upper the uppermost point of the processed part of the image.
+     * @param dim the dimension of the lines.
+     * @param policy the execution policy.
+     * @param f the 1D process.
+     */
+    template <typename TImage, typename TLineFunctor>
+    void sweepImageLines( TImage& image,
+                          const typename TImage::Domain::Point& lower,
+                          const typename TImage::Domain::Point& upper,
+                          typename TImage::Domain::Dimension dim,
+                          const ParallelExecutionPolicy& policy,
+                          TLineFunctor f )
+    {
+      typedef typename TImage::Domain::Point     Point;
+      typedef typename TImage::Domain::Dimension Dimension;
+      typedef typename Point::Coordinate         Coordinate;
+      typedef typename TImage::Value             Value;
+      const Dimension   d      = Point::dimension;
+      const Point       ext    = upper - lower + Point::diagonal( 1 );
+      const std::size_t extent = ext[ dim ];
+      const std::size_t width  = dim == 0 ? 1
+        : std::min( std::max( policy.batchSize, (std::size_t) 1 ), (std::size_t) ext[ 0 ] );
+      const std::size_t nbBatchesPerRow = dim == 0 ? 1 : ( ext[ 0 ] + width - 1 ) / width;
+      std::size_t nbRows = 1;
+      for ( Dimension k = 1; k < d; ++k )
+        if ( k != dim ) nbRows *= ext[ k ];
+      parallelFor( nbRows * nbBatchesPerRow, policy.nbThreads,
+                   [&] ( unsigned int, std::size_t b, std::size_t e )
+                   {
+                     std::vector< Value > buffer;
+                     for ( std::size_t id = b; id < e; ++id )
+                       {
+                         // Starting point of the batch.
+                         Point start = lower;
+                         std::size_t row = id / nbBatchesPerRow;
+                         for ( Dimension k = 1; k < d; ++k )
+                           if ( k != dim )
+                             {
+                               start[ k ] = lower[ k ] + (Coordinate) ( row % ext[ k ] );
+                               row       /= ext[ k ];
+                             }
+                         std::size_t nbLines = 1;
+                         if ( dim != 0 )
+                           {
+                             const std::size_t x0 = ( id % nbBatchesPerRow ) * width;
+                             start[ 0 ] = lower[ 0 ] + (Coordinate) x0;
+                             nbLines    = std::min( width, (std::size_t) ext[ 0 ] - x0 );
+                           }
+                         buffer.resize( nbLines * extent );
+                         // Gathers the lines, interleaved.
+                         Point p = start;
+                         for ( std::size_t t = 0; t < extent; ++t )
+                           {
+                             p[ dim ] = lower[ dim ] + (Coordinate) t;
+                             for ( std::size_t l = 0; l < nbLines; ++l )
+                               {
+                                 if ( dim != 0 ) p[ 0 ] = start[ 0 ] + (Coordinate) l;
+                                 buffer[ t * nbLines + l ] = image( p );
+                               }
+                           }
+                         for ( std::size_t l = 0; l < nbLines; ++l )
+                           {
+                             Point rowPoint = start;
+                             if ( dim != 0 ) rowPoint[ 0 ] += (Coordinate) l;
+                             f( rowPoint, &buffer[ l ], nbLines );
+                           }
+                         // Scatters them back.
+                         for ( std::size_t t = 0; t < extent; ++t )
+                           {
+                             p[ dim ] = lower[ dim ] + (Coordinate) t;
+                             for ( std::size_t l = 0; l < nbLines; ++l )
+                               {
+                                 if ( dim != 0 ) p[ 0 ] = start[ 0 ] + (Coordinate) l;
+                                 image.setValue( p, buffer[ t * nbLines + l ] );
+                               }
+                           }
+                       }
+                   } );
+    }
+
+  } // namespace functions
+} // namespace DGtal
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SeparableSweep_h
+
+#undef SeparableSweep_RECURSES
+#endif // else defined(SeparableSweep_RECURSES)
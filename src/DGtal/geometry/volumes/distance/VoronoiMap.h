@@ -55,6 +55,8 @@
 #include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ParallelFor.h"
+#include "DGtal/geometry/volumes/distance/SeparableSweep.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -114,7 +116,9 @@ namespace DGtal
    * VoronoiMap (default: ImageContainerBySTLVector). The space of the
    * image container and the TSpace should match. Furthermore the
    * container value type must be TSpace::Vector. Lastly, the domain
-   * of the container must be HyperRectDomain.
+   * of the container must be HyperRectDomain. Use
+   * ImageContainerBySiteIndices or ImageContainerByPointOffsets for a
+   * compact storage of the sites.
    */
   template < typename TSpace,
              typename TPointPredicate,
@@ -204,10 +208,16 @@ namespace DGtal
      * Voronoi sites (false points).
      *
      * @param aMetric a pointer to the separable metric instance.
+     *
+     * @param aPolicy the execution policy of the separable passes
+     * (serial by default). With a parallel policy, each 1D sweep is
+     * distributed among threads, by batches of consecutive rows along
+     * the strided dimensions. The result does not depend on the policy.
      */
     VoronoiMap(ConstAlias<Domain> aDomain,
                ConstAlias<PointPredicate> predicate,
-               ConstAlias<SeparableMetric> aMetric);
+               ConstAlias<SeparableMetric> aMetric,
+               ParallelExecutionPolicy const & aPolicy = ParallelExecutionPolicy());
 
     /**
      * Constructor with periodicity specification.
@@ -232,11 +242,15 @@ namespace DGtal
      * @param aPeriodicitySpec an array of size equal to the space dimension
      *        where the i-th value is \c true if the i-th dimension of the
      *        space is periodic, \c false otherwise.
+     *
+     * @param aPolicy the execution policy of the separable passes
+     * (serial by default).
      */
     VoronoiMap(ConstAlias<Domain> aDomain,
                ConstAlias<PointPredicate> predicate,
                ConstAlias<SeparableMetric> aMetric,
-               PeriodicitySpec const & aPeriodicitySpec);
+               PeriodicitySpec const & aPeriodicitySpec,
+               ParallelExecutionPolicy const & aPolicy = ParallelExecutionPolicy());
     /**
      * Default destructor
      */
@@ -295,6 +309,14 @@ namespace DGtal
       return myMetricPtr;
     }
 
+    /**
+     * @return the execution policy of the separable passes.
+     */
+    ParallelExecutionPolicy const & policy() const
+    {
+      return myPolicy;
+    }
+
     /** Periodicity specification.
      *
      * @returns the periodicity specification array.
@@ -376,6 +398,70 @@ namespace DGtal
      */
     typename Point::Coordinate projectCoordinate( typename Point::Coordinate aCoordinate, const Dimension aDim ) const;
 
+  protected:
+    /// Tag type selecting the constructor without computation.
+    struct DeferredComputation {};
+
+    /**
+     * Constructor for derived classes that store the map by
+     * themselves (see OutOfCoreVoronoiMap): no output image is
+     * allocated and the map is not computed. Only the 1D passes
+     * computeOtherStep1D( row, dim, line, stride ) may then be used.
+     *
+     * @param aDomain a pointer to the (hyper-rectangular) domain.
+     * @param predicate a pointer to the point predicate.
+     * @param aMetric a pointer to the separable metric instance.
+     * @param aPeriodicitySpec the periodicity along each dimension.
+     * @param aPolicy the execution policy of the separable passes.
+     */
+    VoronoiMap(ConstAlias<Domain> aDomain,
+               ConstAlias<PointPredicate> predicate,
+               ConstAlias<SeparableMetric> aMetric,
+               PeriodicitySpec const & aPeriodicitySpec,
+               ParallelExecutionPolicy const & aPolicy,
+               DeferredComputation);
+
+    /**
+     * Same as computeOtherStep1D( row, dim ), but working on a copy
+     * of the 1D span: the value at the point of coordinate c along
+     * dimension @a dim is `line[ ( c - lowerBound[ dim ] ) * stride ]`.
+     *
+     * @param [in] row starting point of the 1D process.
+     * @param [in] dim dimension of the update.
+     * @param [in,out] line the values of the map along the 1D span.
+     * @param [in] stride the distance between two consecutive values in @a line.
+     */
+    void computeOtherStep1D (const Point &row,
+                             const Dimension dim,
+                             Point * line,
+                             const std::size_t stride) const;
+
+    /**
+     * 1D process shared by both computeOtherStep1D: reads and writes
+     * the values of the map along the 1D span through @a line, which
+     * is either the output image itself or a StridedLine on a copy of
+     * the span.
+     *
+     * @tparam TLine the type of the line, providing `operator()(const
+     * Point&)` and `setValue(const Point&, const Point&)`.
+     *
+     * @param [in] row starting point of the 1D process.
+     * @param [in] dim dimension of the update.
+     * @param [in,out] line the values of the map along the 1D span.
+     */
+    template <typename TLine>
+    void computeOtherStep1DOnLine (const Point &row,
+                                   const Dimension dim,
+                                   TLine & line) const;
+
+    /**
+     * @return the value marking the points without site.
+     */
+    Point const & infinity() const
+    {
+      return myInfinity;
+    }
+
     // ------------------- Private members ------------------------
   private:
 
@@ -400,6 +486,9 @@ namespace DGtal
     /// Domain extent.
     Point myDomainExtent;
 
+    /// Execution policy of the separable passes.
+    ParallelExecutionPolicy myPolicy;
+
   protected:
 
     ///Pointer to the separable metric instance
@@ -42,7 +42,10 @@
 // Inclusions
 #include <cmath>
 #include <iostream>
+#include <map>
+#include <vector>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelFor.h"
 #include "DGtal/math/BasicMathFunctions.h"
 #include "DGtal/kernel/BasicPointPredicates.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
@@ -50,7 +53,8 @@
 #include "DGtal/kernel/Point2ScalarFunctors.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/geometry/volumes/distance/VoronoiMap.h"
-#include "DGtal/geometry/tools/SpatialCubicalSubdivision.h"
+#include "DGtal/geometry/tools/CPointProximityStructure.h"
+#include "DGtal/geometry/tools/PointKDTree.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -65,7 +69,17 @@ namespace DGtal
    * arbitrary function with given support.
    *
    * You may obtain the whole sequence (Point,VCM) by accessing the
-   * map \ref vcmMap.
+   * map \ref vcmMap, or more efficiently the arrays \ref points and
+   * \ref vcmVector. The VCM of the points are stored densely, the
+   * VCM of the i-th point (in lexicographic order) being the i-th
+   * matrix.
+   *
+   * The computation may be multi-threaded by giving a
+   * ParallelExecutionPolicy at construction: the Voronoi map is then
+   * computed in parallel, the domain is cut into slabs along the
+   * first axis whose Voronoi cells are integrated by distinct threads
+   * in their own matrices, and batched measures are split among
+   * threads. The result does not depend on the number of threads.
    *
    * @note Documentation in \ref moduleVCM_sec2.
    *
@@ -74,12 +88,23 @@ namespace DGtal
    * @tparam TSeparableMetric a model of CSeparableMetric used for
    * computing the Voronoi map (e.g. Euclidean metric is
    * DGtal::ExactPredicateLpSeparableMetric<TSpace, 2> )
+   *
+   * @tparam TImageContainer the image container storing the Voronoi
+   * map (e.g. ImageContainerBySiteIndices for a compact storage).
+   *
+   * @tparam TProximityStructure the structure answering the proximity
+   * queries of \ref measure, a model of
+   * concepts::CPointProximityStructure (a static kd-tree by default).
    */
-  template <typename TSpace, typename TSeparableMetric>
+  template <typename TSpace, typename TSeparableMetric,
+            typename TImageContainer =
+              ImageContainerBySTLVector< HyperRectDomain<TSpace>, typename TSpace::Vector >,
+            typename TProximityStructure = PointKDTree<TSpace> >
   class VoronoiCovarianceMeasure
   {
     BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
     BOOST_CONCEPT_ASSERT(( concepts::CSeparableMetric<TSeparableMetric> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointProximityStructure<TProximityStructure> ));
 
   public:
     typedef TSpace Space;                         ///< the type of digital space
@@ -89,7 +114,7 @@ namespace DGtal
     typedef typename Space::Integer Integer;      ///< the type of each digital point coordinate, some integral type
     typedef DGtal::HyperRectDomain<Space> Domain; ///< the type of rectangular domain of the VCM.
     typedef DGtal::ImageContainerBySTLVector<Domain,bool> CharacteristicSet; ///< the type of a binary image that is the characteristic function of K.
-    typedef DGtal::SpatialCubicalSubdivision<Space> ProximityStructure; ///< the structure used for proximity queries.
+    typedef TProximityStructure ProximityStructure; ///< the structure used for proximity queries.
 
     /**
        A predicate that returns 'true' whenever the given binary image contains 'true'.
@@ -112,7 +137,7 @@ namespace DGtal
       const CharacteristicSet* ptrSet;
     };
     typedef DGtal::functors::NotPointPredicate<CharacteristicSetPredicate> NotPredicate; ///< the type of the point predicate used by the voronoi map.
-    typedef DGtal::VoronoiMap<Space, NotPredicate, Metric > Voronoi; ///< the type of the Voronoi map.
+    typedef DGtal::VoronoiMap<Space, NotPredicate, Metric, TImageContainer > Voronoi; ///< the type of the Voronoi map.
 
     typedef double Scalar;                                    ///< the type for "real" numbers.
     typedef DGtal::SimpleMatrix< Scalar,
@@ -120,6 +145,7 @@ namespace DGtal
                                  Space::dimension > MatrixNN; ///< the type for nxn matrix of real numbers.
     typedef typename MatrixNN::RowVector VectorN;             ///< the type for N-vector of real numbers
     typedef std::vector<Point> PointContainer;                ///< the list of points
+    typedef std::vector<MatrixNN> MatrixNNContainer;          ///< the list of matrices, one per point
     typedef std::map<Point,MatrixNN> Point2MatrixNN;          ///< Associates a matrix to points.
 
     // ----------------------- Standard services ------------------------------
@@ -139,8 +165,11 @@ namespace DGtal
      *
      * @param aMetric an instance of the metric.
      * @param verbose if 'true' displays information on ongoing computation.
+     * @param aPolicy the execution policy of \ref init and of the
+     * batched \ref measure (serial by default).
      */
-    VoronoiCovarianceMeasure( double _R, double _r, Metric aMetric = Metric(), bool verbose = false );
+    VoronoiCovarianceMeasure( double _R, double _r, Metric aMetric = Metric(), bool verbose = false,
+                              ParallelExecutionPolicy const & aPolicy = ParallelExecutionPolicy() );
 
     /**
      * Destructor.
@@ -153,6 +182,8 @@ namespace DGtal
     /// @return the parameter r in VCM(chi_r), i.e. an upper bound for
     /// the diameter of the support of kernel functions.
     Scalar r() const;
+    /// @return the execution policy of the computations.
+    const ParallelExecutionPolicy& policy() const;
  
     /**
        Cleans intermediate data structure likes the characteristic set and the voronoi map.
@@ -182,7 +213,21 @@ namespace DGtal
     /// @return the Voronoi Covariance Matrix of each Voronoi cell as
     /// a map Point -> Matrix
     /// @note empty if \ref init has not been called.
-    const Point2MatrixNN& vcmMap() const;
+    /// @note the map is built at each call, prefer \ref points and \ref vcmVector.
+    Point2MatrixNN vcmMap() const;
+
+    /// @return the points of K, sorted lexicographically and without duplicates.
+    /// @note empty if \ref init has not been called.
+    const PointContainer& points() const;
+
+    /// @return the Voronoi Covariance Matrix of each Voronoi cell, the
+    /// i-th matrix being the one of the i-th point of \ref points.
+    /// @note empty if \ref init has not been called.
+    const MatrixNNContainer& vcmVector() const;
+
+    /// @param p any point.
+    /// @return the index of \a p in \ref points, or points().size() if \a p is not a point of K.
+    Size index( const Point & p ) const;
 
     /**
     Computes the Voronoi Covariance Measure of the function \a chi_r.
@@ -200,6 +245,28 @@ namespace DGtal
     template <typename Point2ScalarFunction>
     MatrixNN measure( Point2ScalarFunction chi_r, Point p ) const;
 
+    /**
+    Computes the Voronoi Covariance Measure of the function \a chi_r
+    moved at each point of the range [itb,ite), with one batched
+    proximity query per thread (see \ref policy).
+
+    @tparam Point2ScalarFunction the type of a functor Point->Scalar.
+    @tparam PointInputIterator an input iterator on digital points.
+    @tparam MatrixOutputIterator an output iterator on MatrixNN.
+
+    @param chi_r the kernel function whose support is included in
+    the cube centered on the origin with edge size 2r.
+    @param itb the start of the range of points (within domain).
+    @param ite the end of the range of points.
+    @param out the output iterator where the measures are written, in the order of the range.
+    @return the output iterator after the last written measure.
+    */
+    template <typename Point2ScalarFunction, typename PointInputIterator,
+              typename MatrixOutputIterator>
+    MatrixOutputIterator measure( Point2ScalarFunction chi_r,
+                                  PointInputIterator itb, PointInputIterator ite,
+                                  MatrixOutputIterator out ) const;
+
     // ----------------------- Interface --------------------------------------
   public:
 
@@ -235,10 +302,14 @@ namespace DGtal
     CharacteristicSet* myCharSet;
     /// Stores the voronoi map.
     Voronoi* myVoronoi;
-    /// The map point -> VCM
-    Point2MatrixNN myVCM;
+    /// The points of K, sorted lexicographically.
+    PointContainer myPoints;
+    /// The VCM of each point of myPoints.
+    MatrixNNContainer myVCM;
     /// The structure used for proximity queries.
     ProximityStructure* myProximityStructure;
+    /// The execution policy of the computations.
+    ParallelExecutionPolicy myPolicy;
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -269,6 +340,27 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /// A matrix to be added to the VCM of a point outside the slab of a thread.
+    typedef std::pair<Size,MatrixNN> IndexedMatrix;
+
+    /**
+       Integrates the Voronoi cells restricted to the points of the
+       box [lo,hi] within the R-offset. The covariance matrix of the
+       point of index i is added to acc[ i - first ] when first <= i <
+       first + acc.size(), otherwise it is pushed in \a others.
+
+       @param lo the lowest point of the box (within domain).
+       @param hi the uppermost point of the box (within domain).
+       @param first the index of the point whose matrix is acc[ 0 ].
+       @param[in,out] acc the matrices where the covariance is accumulated.
+       @param[in,out] others the matrices of the points that are not in \a acc.
+       @param progress if 'true' displays a progress bar.
+    */
+    void accumulate( const Point & lo, const Point & hi,
+                     Size first, MatrixNNContainer & acc,
+                     std::vector<IndexedMatrix> & others,
+                     bool progress ) const;
+
   }; // end of class VoronoiCovarianceMeasure
 
 
@@ -278,10 +370,10 @@ namespace DGtal
    * @param object the object of class 'VoronoiCovarianceMeasure' to write.
    * @return the output stream after the writing.
    */
-  template <typename TSpace, typename TSeparableMetric>
+  template <typename TSpace, typename TSeparableMetric, typename TImageContainer, typename TProximityStructure>
   std::ostream&
   operator<< ( std::ostream & out, 
-               const VoronoiCovarianceMeasure<TSpace, TSeparableMetric> & object );
+               const VoronoiCovarianceMeasure<TSpace, TSeparableMetric, TImageContainer, TProximityStructure> & object );
 
 } // namespace DGtal
 
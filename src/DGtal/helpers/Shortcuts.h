@@ -54,6 +54,7 @@
 #include "DGtal/math/MPolynomial.h"
 #include "DGtal/math/Statistic.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByBits.h"
 #include "DGtal/images/IntervalForegroundPredicate.h"
 #include <DGtal/images/ImageLinearCellEmbedder.h>
 #include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
@@ -72,6 +73,8 @@
 #include "DGtal/topology/helpers/Surfaces.h"
 #include "DGtal/geometry/volumes/KanungoNoise.h"
 #include "DGtal/shapes/Mesh.h"
+#include "DGtal/shapes/MeshVoxelizer.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
 #include "DGtal/io/Color.h"
 #include "DGtal/io/colormaps/GradientColorMap.h"
 #include "DGtal/io/colormaps/TickedColorMap.h"
@@ -137,8 +140,9 @@ namespace DGtal
       typedef ImplicitPolynomial3Shape<Space>              ImplicitShape3D;
       /// defines the digitization of an implicit shape.
       typedef GaussDigitizer< Space, ImplicitShape3D >     DigitizedImplicitShape3D;
-      /// defines a black and white image with (hyper-)rectangular domain.
-      typedef ImageContainerBySTLVector<Domain, bool>      BinaryImage;
+      /// defines a black and white image with (hyper-)rectangular
+      /// domain, with one bit per point.
+      typedef ImageContainerByBits<Domain>                 BinaryImage;
       /// defines a grey-level image with (hyper-)rectangular domain.
       typedef ImageContainerBySTLVector<Domain, GrayScale> GrayScaleImage;
       /// defines a float image with (hyper-)rectangular domain.
@@ -211,6 +215,25 @@ namespace DGtal
           | parametersUtilities();
       }
 
+      /// @param[in] params the parameters:
+      ///   - threads [1]: the number of threads (0: as many as the hardware supports).
+      ///
+      /// @return the number of threads given by \a params, 1 if it is
+      /// missing or negative (with a warning in the latter case).
+      static unsigned int getNbThreads( const Parameters& params )
+      {
+        if ( ! params.count( "threads" ) ) return 1;
+        const int threads = params[ "threads" ].as<int>();
+        if ( threads < 0 )
+          {
+            trace.warning() << "[Shortcuts::getNbThreads]"
+                            << " Negative number of threads " << threads
+                            << ", using 1 thread instead." << std::endl;
+            return 1;
+          }
+        return (unsigned int) threads;
+      }
+
       // ----------------------- ImplicitShape3D static services ------------------------
     public:
 
@@ -696,7 +719,85 @@ namespace DGtal
         return makeBinaryImage( img, params );
       }
 
-    
+      /// Voxelizes the interior of a closed mesh into a binary image
+      /// whose domain is the bounding box of the scaled mesh, enlarged
+      /// by one voxel, so that its digital surface can be extracted
+      /// without any fill pass (see MeshVoxelizer::voxelizeSolid).
+      ///
+      /// @param[in] aMesh a smart pointer on a closed mesh.
+      /// @param[in] params the parameters:
+      ///   - meshScale     [      1.0]: the scale factor applied to the mesh vertices.
+      ///   - meshFillRule  ["NonZero"]: "NonZero"|"EvenOdd" the rule deciding which voxels are inside the mesh.
+      ///   - threads       [        1]: the number of threads (0: as many as the hardware supports).
+      ///   - noise         [      0.0]: specifies the Kanungo noise level for binary pictures.
+      ///
+      /// @return a smart pointer on a binary image that samples the
+      /// interior of the mesh, or 0 if the mesh has no vertex or if
+      /// meshFillRule is invalid.
+      static CountedPtr<BinaryImage>
+        makeBinaryImage
+        ( CountedPtr<Mesh> aMesh,
+          Parameters params = parametersMesh() | parametersBinaryImage() )
+      {
+        if ( aMesh->nbVertex() == 0 ) return CountedPtr<BinaryImage>( 0 );
+        const Scalar scale = params[ "meshScale" ].as<Scalar>();
+        RealPoint lo = aMesh->getVertex( 0 ) * scale;
+        RealPoint up = lo;
+        for ( auto it = aMesh->vertexBegin(), itE = aMesh->vertexEnd(); it != itE; ++it )
+          {
+            lo = lo.inf( *it * scale );
+            up = up.sup( *it * scale );
+          }
+        Point plo, pup;
+        for ( DGtal::Dimension i = 0; i < Point::dimension; ++i )
+          {
+            plo[ i ] = (Integer) std::floor( lo[ i ] ) - 1;
+            pup[ i ] = (Integer) std::ceil ( up[ i ] ) + 1;
+          }
+        return makeBinaryImage( aMesh, Domain( plo, pup ), params );
+      }
+
+      /// Voxelizes the interior of a closed mesh into a binary image
+      /// in the specified domain, and possibly adds Kanungo noise to
+      /// the result (see MeshVoxelizer::voxelizeSolid). Rows are
+      /// classified by scanline crossings with the mesh triangles,
+      /// possibly on several threads.
+      ///
+      /// @param[in] aMesh a smart pointer on a closed mesh.
+      /// @param[in] shapeDomain any domain.
+      /// @param[in] params the parameters:
+      ///   - meshScale     [      1.0]: the scale factor applied to the mesh vertices.
+      ///   - meshFillRule  ["NonZero"]: "NonZero"|"EvenOdd" the rule deciding which voxels are inside the mesh.
+      ///   - threads       [        1]: the number of threads (0: as many as the hardware supports).
+      ///   - noise         [      0.0]: specifies the Kanungo noise level for binary pictures.
+      ///
+      /// @return a smart pointer on a binary image that samples the
+      /// interior of the mesh, or 0 if meshFillRule is invalid.
+      static CountedPtr<BinaryImage>
+        makeBinaryImage
+        ( CountedPtr<Mesh> aMesh,
+          Domain shapeDomain,
+          Parameters params = parametersMesh() | parametersBinaryImage() )
+      {
+        typedef MeshVoxelizer< DigitalSetBySTLVector<Domain>, 6 > Voxelizer;
+        const Scalar       scale   = params[ "meshScale"    ].as<Scalar>();
+        const std::string  rule    = params[ "meshFillRule" ].as<std::string>();
+        const unsigned int threads = getNbThreads( params );
+        if ( rule != "NonZero" && rule != "EvenOdd" )
+          {
+            trace.error() << "[Shortcuts::makeBinaryImage]"
+                          << " Unknown meshFillRule <" << rule
+                          << ">, expected \"NonZero\" or \"EvenOdd\"." << std::endl;
+            return CountedPtr<BinaryImage>( 0 );
+          }
+        CountedPtr<BinaryImage> img ( new BinaryImage( shapeDomain ) );
+        Voxelizer voxelizer;
+        voxelizer.voxelizeSolid( *img, *aMesh, scale,
+                                 rule == "EvenOdd" ? Voxelizer::EVEN_ODD
+                                 : Voxelizer::NON_ZERO, threads );
+        return makeBinaryImage( img, params );
+      }
+
       /// Saves an arbitrary binary image file (e.g. vol file in 3D).
       ///
       /// @param[in] bimage the input binary image.
@@ -992,13 +1093,15 @@ namespace DGtal
       ///   - nbTriesToFindABel   [   100000]: number of tries in method Surfaces::findABel
       ///   - surfaceComponents   [ "AnyBig"]: "AnyBig"|"All", "AnyBig": any big-enough componen
       ///   - surfaceTraversal    ["Default"]: "Default"|"DepthFirst"|"BreadthFirst": "Default" default surface traversal, "DepthFirst": depth-first surface traversal, "BreadthFirst": breadth-first surface traversal.
+      ///   - threads             [        1]: the number of threads used to extract all the boundary surfels of a binary image (0: as many as the hardware supports).
       static Parameters parametersDigitalSurface()
       {
         return Parameters
           ( "surfelAdjacency",   0 )
           ( "nbTriesToFindABel", 100000 )
           ( "surfaceComponents", "AnyBig" )
-          ( "surfaceTraversal",  "Default" );
+          ( "surfaceTraversal",  "Default" )
+          ( "threads",           1 );
       }
 
       /// @tparam TDigitalSurfaceContainer either kind of DigitalSurfaceContainer
@@ -1140,6 +1243,7 @@ namespace DGtal
       ///   - surfelAdjacency   [       0]: specifies the surfel adjacency (1:ext, 0:int)
       ///   - nbTriesToFindABel [  100000]: number of tries in method Surfaces::findABel
       ///   - surfaceComponents ["AnyBig"]: "AnyBig"|"All", "AnyBig": any big-enough component (> twice space width), "All": all components
+      ///   - threads           [       1]: number of threads used when extracting all boundary surfels (0: as many as the hardware supports)
       ///
       /// @return a vector of smart pointers to the connected (light)
       /// digital surfaces present in the binary image.
@@ -1162,8 +1266,7 @@ namespace DGtal
         SurfelAdjacency< KSpace::dimension > surfAdj( surfel_adjacency );
         // Extracts all boundary surfels
         SurfelSet all_surfels;
-        Surfaces<KSpace>::sMakeBoundary( all_surfels, K, *bimage,
-                                         K.lowerBound(), K.upperBound() );
+        makeBoundary( all_surfels, *bimage, K, params );
         // Builds all connected components of surfels.
         SurfelSet marked_surfels;
         CountedPtr<LightDigitalSurface> ptrSurface;
@@ -1199,6 +1302,7 @@ namespace DGtal
       ///
       /// @param[in] params the parameters:
       ///   - surfelAdjacency   [       0]: specifies the surfel adjacency (1:ext, 0:int)
+      ///   - threads           [       1]: number of threads used when extracting boundary surfels of a BinaryImage (0: as many as the hardware supports)
       ///
       /// @return a smart pointer on the explicit digital surface
       /// representing the boundaries in the binary image.
@@ -1213,8 +1317,7 @@ namespace DGtal
           bool      surfel_adjacency = params[ "surfelAdjacency" ].as<int>();
           SurfelAdjacency< KSpace::dimension > surfAdj( surfel_adjacency );
           // Extracts all boundary surfels
-          Surfaces<KSpace>::sMakeBoundary( all_surfels, K, *bimage,
-                                           K.lowerBound(), K.upperBound() );
+          makeBoundary( all_surfels, *bimage, K, params );
           ExplicitSurfaceContainer* surfContainer
             = new ExplicitSurfaceContainer( K, surfAdj, all_surfels );
           return CountedPtr< DigitalSurface >
@@ -1267,6 +1370,7 @@ namespace DGtal
       ///   - surfelAdjacency   [     0]: specifies the surfel adjacency (1:ext, 0:int)
       ///   - nbTriesToFindABel [100000]: number of tries in method Surfaces::findABel
       ///   - surfaceComponents ["AnyBig"]: "AnyBig"|"All", "AnyBig": any big-enough component (> twice space width), "All": all components
+      ///   - threads           [       1]: number of threads used when extracting all boundary surfels (0: as many as the hardware supports)
       ///
       /// @return a smart pointer on the required indexed digital surface.
       static CountedPtr<IdxDigitalSurface>
@@ -1284,8 +1388,7 @@ namespace DGtal
           }
         else if ( component == "All" )
           {
-            Surfaces<KSpace>::sMakeBoundary( surfels, K, *bimage,
-                                             K.lowerBound(), K.upperBound() );
+            makeBoundary( surfels, *bimage, K, params );
           }
         return makeIdxDigitalSurface( surfels, K, params );
       }    
@@ -2032,10 +2135,14 @@ namespace DGtal
       /// @return the parameters and their default values which are
       /// related to meshes.
       ///   - faceSubdivision ["Centroid"]: "No"|"Naive"|"Centroid" specifies how polygonal faces should be subdivided when triangulated or when exported.
+      ///   - meshScale       [     1.0]: the scale factor applied to the mesh vertices when voxelized.
+      ///   - meshFillRule    ["NonZero"]: "NonZero"|"EvenOdd" the rule deciding which voxels are inside a voxelized mesh.
       static Parameters parametersMesh()
       {
         return Parameters
-          ( "faceSubdivision", "Centroid" ); 
+          ( "faceSubdivision", "Centroid" )
+          ( "meshScale",       1.0 )
+          ( "meshFillRule",    "NonZero" );
       }
       
       /// Builds a triangulated surface (class TriangulatedSurface) from
@@ -3226,6 +3333,48 @@ namespace DGtal
       // ------------------------- Hidden services ------------------------------
     protected:
 
+      /// Extracts all the boundary surfels of the digital shape \a pp
+      /// within the domain of \a K.
+      ///
+      /// @param[out] surfels the set where boundary surfels are inserted.
+      /// @param[in] pp any point predicate.
+      /// @param[in] K the Khalimsky space whose domain encompasses the
+      /// digital shape.
+      /// @param[in] params the parameters (unused).
+      template <typename TPointPredicate>
+        static void
+        makeBoundary
+        ( SurfelSet&             surfels,
+          const TPointPredicate& pp,
+          const KSpace&          K,
+          const Parameters&      params )
+        {
+          (void) params;
+          Surfaces<KSpace>::sMakeBoundary( surfels, K, pp,
+                                           K.lowerBound(), K.upperBound() );
+        }
+
+      /// Extracts all the boundary surfels of the binary image \a
+      /// bimage within the domain of \a K, word by word.
+      ///
+      /// @param[out] surfels the set where boundary surfels are inserted.
+      /// @param[in] bimage a binary image.
+      /// @param[in] K the Khalimsky space whose domain encompasses the
+      /// digital shape.
+      /// @param[in] params the parameters:
+      ///   - threads [1]: the number of threads (0: as many as the hardware supports).
+      static void
+        makeBoundary
+        ( SurfelSet&         surfels,
+          const BinaryImage& bimage,
+          const KSpace&      K,
+          const Parameters&  params )
+      {
+        unsigned int threads = getNbThreads( params );
+        Surfaces<KSpace>::sMakeBoundary( surfels, K, bimage,
+                                         K.lowerBound(), K.upperBound(), threads );
+      }
+
       // ------------------------- Internals ------------------------------------
     private:
 
@@ -48,6 +48,7 @@
 #include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
 #include "DGtal/geometry/surfaces/estimation/IntegralInvariantVolumeEstimator.h"
 #include "DGtal/geometry/surfaces/estimation/IntegralInvariantCovarianceEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantMultiScaleEstimator.h"
 
 #if defined(WITH_EIGEN)
 #include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
@@ -81,6 +82,7 @@ namespace DGtal
       typedef ShortcutsGeometry< TKSpace >             Self;
       using Base::parametersKSpace;
       using Base::getKSpace;
+      using Base::getNbThreads;
       using Base::parametersDigitizedImplicitShape3D;
 
       // ----------------------- Usual space types --------------------------------------
@@ -116,8 +118,9 @@ namespace DGtal
       typedef ImplicitPolynomial3Shape<Space>              ImplicitShape3D;
       /// defines the digitization of an implicit shape.
       typedef GaussDigitizer< Space, ImplicitShape3D >     DigitizedImplicitShape3D;
-      /// defines a black and white image with (hyper-)rectangular domain.
-      typedef ImageContainerBySTLVector<Domain, bool>      BinaryImage;
+      /// defines a black and white image with (hyper-)rectangular
+      /// domain, with one bit per point.
+      typedef ImageContainerByBits<Domain>                 BinaryImage;
       /// defines a grey-level image with (hyper-)rectangular domain.
       typedef ImageContainerBySTLVector<Domain, GrayScale> GrayScaleImage;
       /// defines a float image with (hyper-)rectangular domain.
@@ -641,6 +644,8 @@ namespace DGtal
       ///   - kernel          [ "hat"]: the kernel integration function chi_r, either "hat" or "ball". )
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - surfelEmbedding [     0]: the surfel -> point embedding for VCM estimator: 0: Pointels, 1: InnerSpel, 2: OuterSpel.
+      ///   - threads         [     1]: the number of threads used by II and VCM estimators (0: as many as the hardware supports).
+      ///   - ii-kernel       ["moving"]: the way II volumes are computed: "moving" (moving kernel) or "svt" (summed volume table, faster for big radii).
       static Parameters parametersGeometryEstimation()
       {
         return Parameters
@@ -650,7 +655,9 @@ namespace DGtal
           ( "R-radius",       10.0 )
           ( "r-radius",        3.0 )
           ( "alpha",          0.33 )
-          ( "surfelEmbedding",   0 );
+          ( "surfelEmbedding",   0 )
+          ( "threads",           1 )
+          ( "ii-kernel",  "moving" );
       }
 
       /// Given a digital space \a K and a vector of \a surfels,
@@ -745,6 +752,7 @@ namespace DGtal
       ///   - kernel          [ "hat"]: the kernel integration function chi_r, either "hat" or "ball". )
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - surfelEmbedding [     0]: the surfel -> point embedding for VCM estimator: 0: Pointels, 1: InnerSpel, 2: OuterSpel.
+      ///   - threads         [     1]: the number of threads (0: as many as the hardware supports).
       ///   - gridstep [  1.0]: the gridstep that defines the digitization (often called h).
       ///
       /// @return the vector containing the estimated normals, in the
@@ -767,6 +775,7 @@ namespace DGtal
           Scalar      t      = params[ "t-ring"    ].as<Scalar>();
           Scalar      alpha  = params[ "alpha"     ].as<Scalar>();
           int      embedding = params[ "embedding" ].as<int>();
+          unsigned int threads = getNbThreads( params );
           // Adjust parameters according to gridstep if specified.
           if ( alpha != 1.0 ) R *= pow( h, alpha-1.0 );
           if ( alpha != 1.0 ) r *= pow( h, alpha-1.0 );
@@ -793,7 +802,8 @@ namespace DGtal
               KernelFunction chi_r( 1.0, r );
               VCMNormalEstimator estimator;
               estimator.attach( *surface );
-              estimator.setParams( embType, R, r, chi_r, t, Metric(), verbose > 0 );
+              estimator.setParams( embType, R, r, chi_r, t, Metric(), verbose > 0,
+                                   ParallelExecutionPolicy( threads ) );
               estimator.init( h, surfels.begin(), surfels.end() );
               estimator.eval( surfels.begin(), surfels.end(),
                               std::back_inserter( n_estimations ) );
@@ -809,7 +819,8 @@ namespace DGtal
               KernelFunction chi_r( 1.0, r );
               VCMNormalEstimator estimator;
               estimator.attach( *surface );
-              estimator.setParams( embType, R, r, chi_r, t, Metric(), verbose > 0 );
+              estimator.setParams( embType, R, r, chi_r, t, Metric(), verbose > 0,
+                                   ParallelExecutionPolicy( threads ) );
               estimator.init( h, surfels.begin(), surfels.end() );
               estimator.eval( surfels.begin(), surfels.end(),
                               std::back_inserter( n_estimations ) );
@@ -834,6 +845,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads (0: as many as the hardware supports).
       ///
       /// @return the vector containing the estimated normals, in the
       /// same order as \a surfels.
@@ -869,6 +881,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads (0: as many as the hardware supports).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -910,6 +923,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads (0: as many as the hardware supports).
       ///
       /// @return the vector containing the estimated normals, in the
       /// same order as \a surfels.
@@ -938,6 +952,7 @@ namespace DGtal
           Scalar     h       = params[ "gridstep"  ].as<Scalar>();
           Scalar     r       = params[ "r-radius"  ].as<Scalar>();
           Scalar     alpha   = params[ "alpha"     ].as<Scalar>();
+          unsigned int threads = getNbThreads( params );
           if ( alpha != 1.0 ) r *= pow( h, alpha-1.0 );
           if ( verbose > 0 )
             {
@@ -952,7 +967,7 @@ namespace DGtal
           ii_estimator.setParams( r );
           ii_estimator.init( h, surfels.begin(), surfels.end() );
           ii_estimator.eval( surfels.begin(), surfels.end(),
-                             std::back_inserter( n_estimations ) );
+                             std::back_inserter( n_estimations ), threads );
           const RealVectors n_trivial = getTrivialNormalVectors( K, surfels );
           orientVectors( n_estimations, n_trivial );
           return n_estimations;
@@ -971,6 +986,8 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads (0: as many as the hardware supports).
+      ///   - ii-kernel       ["moving"]: "moving" (moving kernel) or "svt" (summed volume table, faster for big radii).
       ///
       /// @return the vector containing the estimated mean curvatures, in the
       /// same order as \a surfels.
@@ -1002,6 +1019,8 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads (0: as many as the hardware supports).
+      ///   - ii-kernel       ["moving"]: "moving" (moving kernel) or "svt" (summed volume table, faster for big radii).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -1041,6 +1060,8 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads (0: as many as the hardware supports).
+      ///   - ii-kernel       ["moving"]: "moving" (moving kernel) or "svt" (summed volume table, faster for big radii).
       ///
       /// @return the vector containing the estimated mean curvatures, in the
       /// same order as \a surfels.
@@ -1065,6 +1086,8 @@ namespace DGtal
           Scalar   h       = params[ "gridstep"  ].as<Scalar>();
           Scalar   r       = params[ "r-radius"  ].as<Scalar>();
           Scalar   alpha   = params[ "alpha"     ].as<Scalar>();
+          unsigned int threads = getNbThreads( params );
+          std::string  kernel  = params[ "ii-kernel" ].as<std::string>();
           if ( alpha != 1.0 ) r *= pow( h, alpha-1.0 );
           if ( verbose > 0 )
             {
@@ -1077,9 +1100,11 @@ namespace DGtal
           IIMeanCurvEstimator ii_estimator( functor );
           ii_estimator.attach( K, shape );
           ii_estimator.setParams( r );
+          if ( kernel == "svt" )
+            ii_estimator.setKernelStrategy( IIMeanCurvEstimator::SUMMED_VOLUME_TABLE );
           ii_estimator.init( h, surfels.begin(), surfels.end() );
           ii_estimator.eval( surfels.begin(), surfels.end(),
-                             std::back_inserter( mc_estimations ) );
+                             std::back_inserter( mc_estimations ), threads );
           return mc_estimations;
         }
 
@@ -1095,6 +1120,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads (0: as many as the hardware supports).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
       /// same order as \a surfels.
@@ -1126,6 +1152,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads (0: as many as the hardware supports).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -1165,6 +1192,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads (0: as many as the hardware supports).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
       /// same order as \a surfels.
@@ -1189,6 +1217,7 @@ namespace DGtal
           Scalar   h       = params[ "gridstep"  ].as<Scalar>();
           Scalar   r       = params[ "r-radius"  ].as<Scalar>();
           Scalar   alpha   = params[ "alpha"     ].as<Scalar>();
+          unsigned int threads = getNbThreads( params );
           if ( alpha != 1.0 ) r *= pow( h, alpha-1.0 );
           if ( verbose > 0 )
             {
@@ -1203,7 +1232,7 @@ namespace DGtal
           ii_estimator.setParams( r );
           ii_estimator.init( h, surfels.begin(), surfels.end() );
           ii_estimator.eval( surfels.begin(), surfels.end(),
-                             std::back_inserter( mc_estimations ) );
+                             std::back_inserter( mc_estimations ), threads );
           return mc_estimations;
         }
 
@@ -1220,6 +1249,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads (0: as many as the hardware supports).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
       /// same order as \a surfels.
@@ -1252,6 +1282,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads (0: as many as the hardware supports).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -1291,6 +1322,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads (0: as many as the hardware supports).
       ///
       /// @return the vector containing the estimated principal curvatures and directions,
       ///  in the same order as \a surfels.
@@ -1314,6 +1346,7 @@ namespace DGtal
         Scalar   h       = params[ "gridstep"  ].as<Scalar>();
         Scalar   r       = params[ "r-radius"  ].as<Scalar>();
         Scalar   alpha   = params[ "alpha"     ].as<Scalar>();
+        unsigned int threads = getNbThreads( params );
         if ( alpha != 1.0 ) r *= pow( h, alpha-1.0 );
         if ( verbose > 0 )
         {
@@ -1328,10 +1361,137 @@ namespace DGtal
         ii_estimator.setParams( r );
         ii_estimator.init( h, surfels.begin(), surfels.end() );
         ii_estimator.eval( surfels.begin(), surfels.end(),
-                          std::back_inserter( mc_estimations ) );
+                          std::back_inserter( mc_estimations ), threads );
         return mc_estimations;
       }
 
+      /// Given a digital shape \a bimage, a sequence of \a surfels,
+      /// a list of radii and some parameters \a params, returns the
+      /// mean curvature Integral Invariant (II) estimations at the
+      /// specified surfels for each radius, with a single traversal
+      /// of the surfels (see IntegralInvariantMultiScaleEstimator).
+      ///
+      /// @param[in] bimage the characteristic function of the shape as a binary image (inside is true, outside is false).
+      /// @param[in] surfels the sequence of surfels at which we compute the mean curvatures
+      /// @param[in] radii the constants r of the kernel radii r(h)=r h^alpha, at most 64 of them.
+      /// @param[in] params the parameters (see getIIMeanCurvatures, "r-radius" and "ii-kernel" are ignored).
+      ///
+      /// @return a vector containing, for each radius in the order of
+      /// \a radii, the estimated mean curvatures in the same order as
+      /// \a surfels.
+      static std::vector< Scalars >
+      getIIMeanCurvaturesMultiScale( CountedPtr<BinaryImage>      bimage,
+                                     const SurfelRange&           surfels,
+                                     const std::vector< Scalar >& radii,
+                                     const Parameters&            params
+                                     = parametersGeometryEstimation()
+                                     | parametersKSpace() )
+      {
+        auto K =  getKSpace( bimage, params );
+        return getIIMeanCurvaturesMultiScale( *bimage, K, surfels, radii, params );
+      }
+
+      /// Given an arbitrary PointPredicate \a shape: Point -> boolean, a Khalimsky
+      /// space \a K, a sequence of \a surfels, a list of radii and
+      /// some parameters \a params, returns the mean curvature
+      /// Integral Invariant (II) estimations at the specified surfels
+      /// for each radius, with a single traversal of the surfels (see
+      /// IntegralInvariantMultiScaleEstimator). Results are identical
+      /// to the ones of getIIMeanCurvatures called with each radius.
+      ///
+      /// @tparam TPointPredicate any type of map Point -> boolean.
+      /// @param[in] shape a function Point -> boolean telling if you are inside the shape.
+      /// @param[in] K the Khalimsky space where the shape and surfels live.
+      /// @param[in] surfels the sequence of surfels at which we compute the mean curvatures
+      /// @param[in] radii the constants r of the kernel radii r(h)=r h^alpha, at most 64 of them.
+      /// @param[in] params the parameters:
+      ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
+      ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads (0: as many as the hardware supports).
+      ///
+      /// @return a vector containing, for each radius in the order of
+      /// \a radii, the estimated mean curvatures in the same order as
+      /// \a surfels.
+      template <typename TPointPredicate>
+      static std::vector< Scalars >
+      getIIMeanCurvaturesMultiScale( const TPointPredicate&       shape,
+                                     const KSpace&                K,
+                                     const SurfelRange&           surfels,
+                                     const std::vector< Scalar >& radii,
+                                     const Parameters&            params
+                                     = parametersGeometryEstimation()
+                                     | parametersKSpace() )
+      {
+        typedef functors::IIMeanCurvature3DFunctor<Space> IIMeanCurvFunctor;
+        return getIIMultiScale< IIMeanCurvFunctor >( shape, K, surfels, radii, params );
+      }
+
+      /// Given a digital shape \a bimage, a sequence of \a surfels,
+      /// a list of radii and some parameters \a params, returns the
+      /// principal curvatures and directions using Integral Invariant
+      /// (II) estimation at the specified surfels for each radius,
+      /// with a single traversal of the surfels (see
+      /// IntegralInvariantMultiScaleEstimator).
+      ///
+      /// @param[in] bimage the characteristic function of the shape as a binary image (inside is true, outside is false).
+      /// @param[in] surfels the sequence of surfels at which we compute the curvatures
+      /// @param[in] radii the constants r of the kernel radii r(h)=r h^alpha, at most 64 of them.
+      /// @param[in] params the parameters (see getIIPrincipalCurvaturesAndDirections, "r-radius" is ignored).
+      ///
+      /// @return a vector containing, for each radius in the order of
+      /// \a radii, the estimated principal curvatures and directions
+      /// in the same order as \a surfels.
+      static std::vector< CurvatureTensorQuantities >
+      getIIPrincipalCurvaturesAndDirectionsMultiScale( CountedPtr<BinaryImage>      bimage,
+                                                       const SurfelRange&           surfels,
+                                                       const std::vector< Scalar >& radii,
+                                                       const Parameters&            params
+                                                       = parametersGeometryEstimation()
+                                                       | parametersKSpace() )
+      {
+        auto K =  getKSpace( bimage, params );
+        return getIIPrincipalCurvaturesAndDirectionsMultiScale( *bimage, K, surfels, radii, params );
+      }
+
+      /// Given an arbitrary PointPredicate \a shape: Point -> boolean, a Khalimsky
+      /// space \a K, a sequence of \a surfels, a list of radii and
+      /// some parameters \a params, returns the principal curvatures
+      /// and directions using Integral Invariant (II) estimation at
+      /// the specified surfels for each radius, with a single
+      /// traversal of the surfels (see
+      /// IntegralInvariantMultiScaleEstimator). Results are identical
+      /// to the ones of getIIPrincipalCurvaturesAndDirections called
+      /// with each radius.
+      ///
+      /// @tparam TPointPredicate any type of map Point -> boolean.
+      /// @param[in] shape a function Point -> boolean telling if you are inside the shape.
+      /// @param[in] K the Khalimsky space where the shape and surfels live.
+      /// @param[in] surfels the sequence of surfels at which we compute the curvatures
+      /// @param[in] radii the constants r of the kernel radii r(h)=r h^alpha, at most 64 of them.
+      /// @param[in] params the parameters:
+      ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
+      ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads (0: as many as the hardware supports).
+      ///
+      /// @return a vector containing, for each radius in the order of
+      /// \a radii, the estimated principal curvatures and directions
+      /// in the same order as \a surfels.
+      template <typename TPointPredicate>
+      static std::vector< CurvatureTensorQuantities >
+      getIIPrincipalCurvaturesAndDirectionsMultiScale( const TPointPredicate&       shape,
+                                                       const KSpace&                K,
+                                                       const SurfelRange&           surfels,
+                                                       const std::vector< Scalar >& radii,
+                                                       const Parameters&            params
+                                                       = parametersGeometryEstimation()
+                                                       | parametersKSpace() )
+      {
+        typedef functors::IIPrincipalCurvaturesAndDirectionsFunctor<Space> IICurvFunctor;
+        return getIIMultiScale< IICurvFunctor >( shape, K, surfels, radii, params );
+      }
+
       /// @}
 
       // --------------------------- AT approximation ------------------------------
@@ -1803,6 +1963,63 @@ namespace DGtal
       // ------------------------- Hidden services ------------------------------
     protected:
 
+      /// Computes Integral Invariant estimations for several radii
+      /// with a single IntegralInvariantMultiScaleEstimator, and
+      /// returns them radius per radius.
+      ///
+      /// @tparam TFunctor the type of II functor (on volumes or covariance matrices).
+      /// @tparam TPointPredicate any type of map Point -> boolean.
+      /// @param[in] shape a function Point -> boolean telling if you are inside the shape.
+      /// @param[in] K the Khalimsky space where the shape and surfels live.
+      /// @param[in] surfels the sequence of surfels.
+      /// @param[in] radii the constants r of the kernel radii r(h)=r h^alpha.
+      /// @param[in] params the parameters (verbose, alpha, gridstep, threads).
+      /// @return for each radius, the estimations in the same order as \a surfels.
+      template <typename TFunctor, typename TPointPredicate>
+      static std::vector< std::vector< typename TFunctor::Quantity > >
+      getIIMultiScale( const TPointPredicate&       shape,
+                       const KSpace&                K,
+                       const SurfelRange&           surfels,
+                       const std::vector< Scalar >& radii,
+                       const Parameters&            params )
+      {
+        typedef IntegralInvariantMultiScaleEstimator
+          <KSpace, TPointPredicate, TFunctor>              IIEstimator;
+        typedef typename IIEstimator::Quantity              IIQuantity;
+
+        int      verbose = params[ "verbose"   ].as<int>();
+        Scalar   h       = params[ "gridstep"  ].as<Scalar>();
+        Scalar   alpha   = params[ "alpha"     ].as<Scalar>();
+        unsigned int threads = getNbThreads( params );
+        std::vector< Scalar > dRadii( radii );
+        if ( alpha != 1.0 )
+          for ( auto& r : dRadii ) r *= pow( h, alpha-1.0 );
+        if ( verbose > 0 )
+          trace.info() << "- II multi-scale alpha=" << alpha
+                       << " #radii=" << dRadii.size() << std::endl;
+        IIEstimator ii_estimator;
+        ii_estimator.attach( K, shape );
+        ii_estimator.setParams( dRadii );
+        ii_estimator.init( h, surfels.begin(), surfels.end() );
+        std::vector< IIQuantity > estimations;
+        estimations.reserve( surfels.size() );
+        ii_estimator.eval( surfels.begin(), surfels.end(),
+                           std::back_inserter( estimations ), threads );
+        // The estimator sorts the radii, results are given back in
+        // the order of the input radii.
+        std::vector< std::vector< typename TFunctor::Quantity > > result( radii.size() );
+        for ( std::size_t j = 0; j < dRadii.size(); ++j )
+          {
+            const std::size_t i = std::lower_bound( ii_estimator.radii().begin(),
+                                                    ii_estimator.radii().end(),
+                                                    dRadii[ j ] )
+              - ii_estimator.radii().begin();
+            result[ j ].reserve( estimations.size() );
+            for ( auto&& q : estimations ) result[ j ].push_back( q[ i ] );
+          }
+        return result;
+      }
+
       // ------------------------- Internals ------------------------------------
     private:
 
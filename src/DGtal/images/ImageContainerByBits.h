@@ -0,0 +1,467 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByBits.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ImageContainerByBits.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByBits_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByBits.h
+#else // defined(ImageContainerByBits_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByBits_RECURSES
+
+#if !defined ImageContainerByBits_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByBits_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/SetValueIterator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerByBits
+  /**
+   * Description of template class 'ImageContainerByBits' <p>
+   * \brief Aim: Model of concepts::CImage storing a binary image
+   * (Value is bool) on a hyper-rectangular domain with one bit per
+   * point, or as runs of true values.
+   *
+   * The image is made of rows, i.e. lines along the first dimension.
+   * Two encodings are available, and the image can be converted from
+   * one to the other at any time (see setEncoding()):
+   *
+   * - BIT_PACKED (default): each row is stored as a sequence of 64-bit
+   *   words (wordsPerRow() words per row, the bit i of word w being
+   *   the point of coordinate 64w+i along the row, padding bits being
+   *   always 0). This divides by 8 the memory of an
+   *   ImageContainerBySTLVector<Domain,bool> and gives direct access
+   *   to the words of each row (see rowWords()), so that algorithms
+   *   can process 64 points at once.
+   *
+   * - RUN_LENGTH: each row is stored as a sorted list of runs of true
+   *   values, which is very compact for sparse or smooth
+   *   segmentations. Reading a point is logarithmic in the number of
+   *   runs of its row, and writing is linear in it.
+   *
+   * Whatever the encoding, getRowWords() and setRowWords() give a
+   * word-level access to the rows. The image also offers random
+   * access iterators on its values in the order of the domain, like
+   * ImageContainerBySTLVector (writable ones return a proxy, like
+   * std::vector<bool>), so that it is a drop-in replacement of the
+   * latter, e.g. as Shortcuts::BinaryImage.
+   *
+   * @note Distinct points of a same word (resp. row) cannot be written
+   * concurrently in BIT_PACKED (resp. RUN_LENGTH) encoding.
+   *
+   * @tparam TDomain the type of domain, a HyperRectDomain.
+   *
+   * @see testImageContainerByBits.cpp
+   */
+  template < typename TDomain >
+  class ImageContainerByBits
+  {
+  public:
+    typedef ImageContainerByBits< TDomain > Self;
+    typedef TDomain                         Domain;
+    typedef typename Domain::Point          Point;
+    typedef typename Domain::Vector         Vector;
+    typedef typename Domain::Integer        Integer;
+    typedef typename Domain::Size           Size;
+    typedef typename Domain::Dimension      Dimension;
+    typedef typename Point::Coordinate      Coordinate;
+    typedef Point                           Vertex;
+    static const Dimension dimension = Domain::dimension;
+
+    /// range of values
+    typedef bool                          Value;
+    typedef DefaultConstImageRange<Self>  ConstRange;
+    typedef DefaultImageRange<Self>       Range;
+
+    /// output iterator
+    typedef SetValueIterator<Self>        OutputIterator;
+
+    /// The type of the words of a row.
+    typedef DGtal::uint64_t               Word;
+    /// The number of bits of a word.
+    static const unsigned int bitsPerWord = 64;
+    /// A run [first,second) of true values along a row.
+    typedef std::pair< DGtal::uint32_t, DGtal::uint32_t > Run;
+
+    /// The possible encodings of the image.
+    enum Encoding { BIT_PACKED, RUN_LENGTH };
+
+    /**
+     * Proxy on the value of a point, returned by writable iterators.
+     */
+    class Reference
+    {
+    public:
+      /// Constructor from an image, a row and a position along it.
+      Reference( Self * anImage, Size aRow, Size aX )
+        : myImage( anImage ), myRow( aRow ), myX( aX ) {}
+      /// @return the value.
+      operator bool() const { return myImage->getBit( myRow, myX ); }
+      /// Sets the value.
+      /// @param aValue the new value.
+      /// @return a reference on 'this'.
+      Reference & operator=( bool aValue )
+      {
+        myImage->setBit( myRow, myX, aValue );
+        return *this;
+      }
+      /// Sets the value of another proxy.
+      /// @param other another proxy.
+      /// @return a reference on 'this'.
+      Reference & operator=( const Reference & other )
+      {
+        return *this = (bool) other;
+      }
+    private:
+      Self * myImage;
+      Size   myRow;
+      Size   myX;
+    };
+
+    /**
+     * Random access iterator on the values of the image, in the order
+     * of the domain.
+     *
+     * @tparam TImage Self or const Self.
+     * @tparam TReference Reference or bool.
+     */
+    template < typename TImage, typename TReference >
+    class ValueIterator
+      : public boost::iterator_facade< ValueIterator< TImage, TReference >,
+                                       bool, std::random_access_iterator_tag,
+                                       TReference, std::ptrdiff_t >
+    {
+    public:
+      /// Default constructor.
+      ValueIterator() : myImage( 0 ), myIndex( 0 ) {}
+      /// Constructor from an image and an index in the domain order.
+      ValueIterator( TImage * anImage, Size anIndex )
+        : myImage( anImage ), myIndex( anIndex ) {}
+      /// Conversion from a writable iterator to a constant one.
+      template < typename TOtherImage, typename TOtherReference >
+      ValueIterator( const ValueIterator< TOtherImage, TOtherReference > & other )
+        : myImage( other.myImage ), myIndex( other.myIndex ) {}
+    private:
+      template < typename, typename > friend class ValueIterator;
+      friend class boost::iterator_core_access;
+      TReference dereference() const
+      {
+        return myImage->valueAt( myIndex );
+      }
+      template < typename TOtherImage, typename TOtherReference >
+      bool equal( const ValueIterator< TOtherImage, TOtherReference > & other ) const
+      {
+        return myIndex == other.myIndex;
+      }
+      void increment() { ++myIndex; }
+      void decrement() { --myIndex; }
+      void advance( std::ptrdiff_t n ) { myIndex += n; }
+      template < typename TOtherImage, typename TOtherReference >
+      std::ptrdiff_t distance_to( const ValueIterator< TOtherImage, TOtherReference > & other ) const
+      {
+        return (std::ptrdiff_t) other.myIndex - (std::ptrdiff_t) myIndex;
+      }
+      TImage * myImage;
+      Size     myIndex;
+    };
+
+    typedef ValueIterator< Self, Reference >        Iterator;
+    typedef ValueIterator< const Self, bool >       ConstIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Every value is false.
+     *
+     * @param aDomain the image domain.
+     * @param anEncoding the encoding of the image.
+     */
+    ImageContainerByBits( const Domain & aDomain,
+                          Encoding anEncoding = BIT_PACKED );
+
+    /**
+     * Destructor.
+     */
+    ~ImageContainerByBits() = default;
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    ImageContainerByBits( const Self & other ) = default;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    Self & operator=( const Self & other ) = default;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Get the value of the image at a given point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Set the value of the image at a given point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the extent of the image.
+     */
+    Vector extent() const;
+
+    /**
+     * @return the const range providing constant
+     * iterators to iterate over the values of the image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing constant iterators
+     * and output iterators on the values of the image.
+     */
+    Range range();
+
+    /// @return an iterator on the value of the first point of the domain.
+    Iterator begin();
+    /// @return an iterator after the value of the last point of the domain.
+    Iterator end();
+    /// @return an iterator on the value of the first point of the domain.
+    ConstIterator begin() const;
+    /// @return an iterator after the value of the last point of the domain.
+    ConstIterator end() const;
+
+    /**
+     * Sets every value of the image.
+     * @param aValue the value.
+     */
+    void fill( const Value & aValue );
+
+    /**
+     * @return the number of true values.
+     */
+    Size count() const;
+
+    // ----------------------- Encoding and row services ----------------------
+  public:
+
+    /**
+     * @return the current encoding.
+     */
+    Encoding encoding() const;
+
+    /**
+     * Converts the image to another encoding (the values are kept).
+     * @param anEncoding the new encoding.
+     */
+    void setEncoding( Encoding anEncoding );
+
+    /**
+     * @return the number of rows (lines along the first dimension).
+     */
+    Size nbRows() const;
+
+    /**
+     * @return the number of words of a row.
+     */
+    Size wordsPerRow() const;
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return the index of the row of @a aPoint.
+     */
+    Size rowIndex( const Point & aPoint ) const;
+
+    /**
+     * @param aRow the index of a row.
+     * @return the first point of the row.
+     */
+    Point rowStart( Size aRow ) const;
+
+    /**
+     * Direct access to the words of a row.
+     * @pre the encoding is BIT_PACKED.
+     * @param aRow the index of a row.
+     * @return a pointer on its wordsPerRow() words.
+     */
+    const Word * rowWords( Size aRow ) const;
+
+    /**
+     * Direct access to the words of a row. Padding bits must be left
+     * to 0.
+     * @pre the encoding is BIT_PACKED.
+     * @param aRow the index of a row.
+     * @return a pointer on its wordsPerRow() words.
+     */
+    Word * rowWords( Size aRow );
+
+    /**
+     * Copies the words of a row, whatever the encoding.
+     * @param aRow the index of a row.
+     * @param words (returns) an array of wordsPerRow() words.
+     */
+    void getRowWords( Size aRow, Word * words ) const;
+
+    /**
+     * Sets the words of a row, whatever the encoding (padding bits are
+     * ignored).
+     * @param aRow the index of a row.
+     * @param words an array of wordsPerRow() words.
+     */
+    void setRowWords( Size aRow, const Word * words );
+
+    /**
+     * @return the number of bytes used by the image (excluding the
+     * domain).
+     */
+    Size memoryUsage() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The image domain.
+    Domain myDomain;
+    /// The extent of the domain.
+    Vector myExtent;
+    /// The number of rows.
+    Size myNbRows;
+    /// The number of words of a row.
+    Size myWordsPerRow;
+    /// The current encoding.
+    Encoding myEncoding;
+    /// The words of the rows (BIT_PACKED encoding).
+    std::vector< Word > myWords;
+    /// The runs of the rows (RUN_LENGTH encoding).
+    std::vector< std::vector< Run > > myRuns;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * @param aRow the index of a row.
+     * @param aX the position along the row.
+     * @return the value at this position.
+     */
+    bool getBit( Size aRow, Size aX ) const;
+
+    /**
+     * @param aRow the index of a row.
+     * @param aX the position along the row.
+     * @param aValue the new value at this position.
+     */
+    void setBit( Size aRow, Size aX, bool aValue );
+
+    /// @param anIndex an index in the domain order.
+    /// @return the value of the point of this index.
+    bool valueAt( Size anIndex ) const;
+
+    /// @param anIndex an index in the domain order.
+    /// @return a proxy on the value of the point of this index.
+    Reference valueAt( Size anIndex );
+
+    /// @return the mask of the valid bits of the last word of a row.
+    Word lastWordMask() const;
+
+  }; // end of class ImageContainerByBits
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByBits'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByBits' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TDomain >
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageContainerByBits< TDomain > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByBits.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByBits_h
+
+#undef ImageContainerByBits_RECURSES
+#endif // else defined(ImageContainerByBits_RECURSES)
@@ -0,0 +1,276 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByPointOffsets.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ImageContainerByPointOffsets.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByPointOffsets_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByPointOffsets.h
+#else // defined(ImageContainerByPointOffsets_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByPointOffsets_RECURSES
+
+#if !defined ImageContainerByPointOffsets_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByPointOffsets_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include <boost/type_traits/is_signed.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/OverflowTable.h"
+#include "DGtal/images/SetValueIterator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerByPointOffsets
+  /**
+   * Description of template class 'ImageContainerByPointOffsets' <p>
+   * \brief Aim: Model of concepts::CImage associating a point to each
+   * point of an hyper-rectangular domain, where each value is stored
+   * as a small signed offset from the point it is associated to.
+   *
+   * This is a compact storage for images like Voronoi maps or power
+   * maps, where the value at a point p is a nearby site q: only the
+   * d coordinates of q - p are stored, each one as a \a TOffset.
+   * With the default 16-bit offsets, a 3D map takes 6 bytes per point
+   * instead of 12 (resp. 24) bytes for 32-bit (resp. 64-bit) points
+   * in an ImageContainerBySTLVector, i.e. 1/2 (resp. 1/4) of its
+   * memory; 8-bit offsets give 1/4 (resp. 1/8) but overflow for sites
+   * further than 126 points. ImageContainerBySiteIndices stores a
+   * 32-bit index per point instead (1/3 of the memory of 32-bit 3D
+   * points), whatever the distance to the site. Values that cannot be stored
+   * this way go to an overflow table. The point whose coordinates are
+   * all equal to the greatest coordinate value (used as infinity by
+   * VoronoiMap and PowerMap) is encoded without the overflow table.
+   *
+   * It is thus a drop-in replacement of the default output image of
+   * VoronoiMap, DistanceTransformation or PowerMap:
+   *
+   * @code
+   * typedef ImageContainerByPointOffsets< Z3i::Domain > CompactImage;
+   * DistanceTransformation< Z3i::Space, Predicate, Z3i::L2Metric, CompactImage >
+   *   dt( domain, predicate, Z3i::l2Metric );
+   * @endcode
+   *
+   * The image can be read and written concurrently at distinct
+   * points (see OverflowTable). Values stored as offsets never touch
+   * the overflow table.
+   *
+   * @tparam TDomain the type of domain, a HyperRectDomain.
+   * @tparam TOffset the signed integral type of each offset
+   * coordinate. Its two smallest values are reserved.
+   *
+   * @see testImageContainerByPointOffsets.cpp
+   */
+  template < typename TDomain, typename TOffset = DGtal::int16_t >
+  class ImageContainerByPointOffsets
+  {
+  public:
+    typedef ImageContainerByPointOffsets< TDomain, TOffset > Self;
+    typedef TDomain                                          Domain;
+    typedef typename Domain::Point                           Point;
+    typedef typename Domain::Vector                          Vector;
+    typedef typename Domain::Integer                         Integer;
+    typedef typename Domain::Size                            Size;
+    typedef typename Domain::Dimension                       Dimension;
+    typedef typename Point::Coordinate                       Coordinate;
+    typedef Point                                            Vertex;
+    typedef TOffset                                          Offset;
+    static const Dimension dimension = Domain::dimension;
+
+    BOOST_STATIC_ASSERT(( boost::is_signed< Offset >::value ));
+
+    /// range of values
+    typedef Point                         Value;
+    typedef DefaultConstImageRange<Self>  ConstRange;
+    typedef DefaultImageRange<Self>       Range;
+
+    /// output iterator
+    typedef SetValueIterator<Self>        OutputIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Every point is associated to itself.
+     *
+     * @param aDomain the image domain.
+     */
+    ImageContainerByPointOffsets( const Domain & aDomain );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    ImageContainerByPointOffsets( const Self & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    Self & operator=( const Self & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Get the value of the image at a given point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Set the value of the image at a given point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the const range providing constant
+     * iterators to iterate over the values of the image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing constant iterators
+     * and output iterators on the values of the image.
+     */
+    Range range();
+
+    /**
+     * @return an output iterator on the image.
+     */
+    OutputIterator outputIterator();
+
+    /**
+     * @return the number of values stored in the overflow table.
+     */
+    Size nbOverflows() const;
+
+    /**
+     * @return the number of bytes used by the image (an estimation
+     * for the overflow table).
+     */
+    Size memoryUsage() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// Marker of the first offset coordinate for the infinity point.
+    static const Offset INFINITY_CODE = std::numeric_limits< Offset >::min();
+    /// Marker of the first offset coordinate for an overflowed value.
+    static const Offset OVERFLOW_CODE = std::numeric_limits< Offset >::min() + 1;
+
+    /// The image domain.
+    Domain myDomain;
+    /// The extent of the domain.
+    Vector myExtent;
+    /// The d offset coordinates of each point, in linearized order.
+    std::vector< Offset > myOffsets;
+    /// The values that do not fit in offsets, indexed by linearized point.
+    OverflowTable< Value > myOverflows;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return its index in the linearized domain.
+     */
+    Size linearized( const Point & aPoint ) const;
+
+    /// @return the point used as infinity.
+    static Value infinity();
+
+  }; // end of class ImageContainerByPointOffsets
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByPointOffsets'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByPointOffsets' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TDomain, typename TOffset >
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ImageContainerByPointOffsets< TDomain, TOffset > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByPointOffsets.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByPointOffsets_h
+
+#undef ImageContainerByPointOffsets_RECURSES
+#endif // else defined(ImageContainerByPointOffsets_RECURSES)
@@ -0,0 +1,289 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerBySiteIndices.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module ImageContainerBySiteIndices.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerBySiteIndices_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerBySiteIndices.h
+#else // defined(ImageContainerBySiteIndices_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerBySiteIndices_RECURSES
+
+#if !defined ImageContainerBySiteIndices_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerBySiteIndices_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include <boost/type_traits/is_unsigned.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/OverflowTable.h"
+#include "DGtal/images/SetValueIterator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerBySiteIndices
+  /**
+   * Description of template class 'ImageContainerBySiteIndices' <p>
+   * \brief Aim: Model of concepts::CImage associating a point to each
+   * point of an hyper-rectangular domain, where each value is stored
+   * as its linearized index in a box of sites.
+   *
+   * This is a compact storage for images like Voronoi maps or power
+   * maps, where the value at each point is a site: a single \a TIndex
+   * is stored per point. With the default 32-bit indices, a 3D map
+   * takes 4 bytes per point instead of 12 (resp. 24) bytes for 32-bit
+   * (resp. 64-bit) points in an ImageContainerBySTLVector, i.e. 1/3
+   * (resp. 1/6) of its memory, whatever the distance between a point
+   * and its site (compare with ImageContainerByPointOffsets).
+   *
+   * The box of sites is the domain extended by its extent on each
+   * side, so that the unprojected sites of periodic Voronoi maps are
+   * encoded too, when the number of its points fits in \a TIndex
+   * (e.g. up to about 540^3 domains with 32-bit indices). Otherwise, it is
+   * the domain itself, and unprojected sites go to the overflow table
+   * like any value outside the box. The point whose coordinates are
+   * all equal to the greatest coordinate value (used as infinity by
+   * VoronoiMap and PowerMap) is encoded without the overflow table.
+   *
+   * It is thus a drop-in replacement of the default output image of
+   * VoronoiMap, DistanceTransformation or PowerMap:
+   *
+   * @code
+   * typedef ImageContainerBySiteIndices< Z3i::Domain > CompactImage;
+   * DistanceTransformation< Z3i::Space, Predicate, Z3i::L2Metric, CompactImage >
+   *   dt( domain, predicate, Z3i::l2Metric );
+   * @endcode
+   *
+   * The image can be read and written concurrently at distinct
+   * points (see OverflowTable).
+   *
+   * @tparam TDomain the type of domain, a HyperRectDomain. Its number
+   * of points must be smaller than the greatest \a TIndex value minus
+   * one, otherwise every value overflows.
+   * @tparam TIndex the unsigned integral type of indices. Its two
+   * greatest values are reserved.
+   *
+   * @see testImageContainerBySiteIndices.cpp
+   */
+  template < typename TDomain, typename TIndex = DGtal::uint32_t >
+  class ImageContainerBySiteIndices
+  {
+  public:
+    typedef ImageContainerBySiteIndices< TDomain, TIndex > Self;
+    typedef TDomain                                        Domain;
+    typedef typename Domain::Point                         Point;
+    typedef typename Domain::Vector                        Vector;
+    typedef typename Domain::Integer                       Integer;
+    typedef typename Domain::Size                          Size;
+    typedef typename Domain::Dimension                     Dimension;
+    typedef typename Point::Coordinate                     Coordinate;
+    typedef Point                                          Vertex;
+    typedef TIndex                                         Index;
+    static const Dimension dimension = Domain::dimension;
+
+    BOOST_STATIC_ASSERT(( boost::is_unsigned< Index >::value ));
+
+    /// range of values
+    typedef Point                         Value;
+    typedef DefaultConstImageRange<Self>  ConstRange;
+    typedef DefaultImageRange<Self>       Range;
+
+    /// output iterator
+    typedef SetValueIterator<Self>        OutputIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Every point is associated to itself.
+     *
+     * @param aDomain the image domain.
+     */
+    ImageContainerBySiteIndices( const Domain & aDomain );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Get the value of the image at a given point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Set the value of the image at a given point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the const range providing constant
+     * iterators to iterate over the values of the image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing constant iterators
+     * and output iterators on the values of the image.
+     */
+    Range range();
+
+    /**
+     * @return an output iterator on the image.
+     */
+    OutputIterator outputIterator();
+
+    /**
+     * @return the number of values stored in the overflow table.
+     */
+    Size nbOverflows() const;
+
+    /**
+     * @return the number of bytes used by the image (an estimation
+     * for the overflow table).
+     */
+    Size memoryUsage() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// Code of the infinity point.
+    static const Index INFINITY_CODE = std::numeric_limits< Index >::max();
+    /// Code of an overflowed value.
+    static const Index OVERFLOW_CODE = std::numeric_limits< Index >::max() - 1;
+
+    /// The image domain.
+    Domain myDomain;
+    /// The extent of the domain.
+    Vector myExtent;
+    /// The lowest point of the box of sites.
+    Point mySiteLower;
+    /// The extent of the box of sites.
+    Vector mySiteExtent;
+    /// The code of each point, in linearized order.
+    std::vector< Index > myCodes;
+    /// The values that do not fit in the box of sites, indexed by
+    /// linearized point.
+    OverflowTable< Value > myOverflows;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return its index in the linearized domain.
+     */
+    Size linearized( const Point & aPoint ) const;
+
+    /**
+     * Computes the code of a value.
+     *
+     * @param aValue any value but infinity.
+     * @param[out] code the index of \a aValue in the box of sites, if
+     * it fits.
+     * @return 'true' if \a aValue is in the box of sites and its index
+     * is smaller than OVERFLOW_CODE, 'false' otherwise.
+     */
+    bool encode( const Value & aValue, Index & code ) const;
+
+    /**
+     * @param code a code smaller than OVERFLOW_CODE.
+     * @return the value of index \a code in the box of sites.
+     */
+    Value decode( Index code ) const;
+
+    /// @return the point used as infinity.
+    static Value infinity();
+
+  }; // end of class ImageContainerBySiteIndices
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerBySiteIndices'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerBySiteIndices' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TDomain, typename TIndex >
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ImageContainerBySiteIndices< TDomain, TIndex > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerBySiteIndices.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerBySiteIndices_h
+
+#undef ImageContainerBySiteIndices_RECURSES
+#endif // else defined(ImageContainerBySiteIndices_RECURSES)
@@ -0,0 +1,224 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MemoryMappedImage.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module MemoryMappedImage.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MemoryMappedImage_RECURSES)
+#error Recursive header files inclusion detected in MemoryMappedImage.h
+#else // defined(MemoryMappedImage_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MemoryMappedImage_RECURSES
+
+#if !defined MemoryMappedImage_h
+/** Prevents repeated inclusion of headers. */
+#define MemoryMappedImage_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <type_traits>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CountedPtr.h"
+#include "DGtal/images/ArrayImageAdapter.h"
+#include "DGtal/io/readers/MemoryMappedFile.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MemoryMappedImage
+  /**
+   * Description of template class 'MemoryMappedImage' <p>
+   * \brief Aim: read-only image whose values are the ones stored in a
+   * memory mapped file (see MemoryMappedFile), without copying them.
+   *
+   * It is an ArrayImageAdapter over a constant pointer, hence a model
+   * of concepts::CConstImage, which also shares the ownership of the
+   * mapping (or of a buffer): copies are shallow and cheap, and the
+   * values remain valid as long as one copy lives.
+   *
+   * Values are stored in the file in column-major order (first
+   * coordinate first), either in little-endian byte order (e.g. Longvol
+   * files) or in the byte order of the host (e.g. Raw files, see
+   * RawWriter). They are used in place whenever possible, i.e. when
+   * their byte order is the one of the host and they are suitably
+   * aligned in the mapping; otherwise they are copied once into an
+   * owned buffer (see isZeroCopy). An owned buffer
+   * is also used for data that must be decoded, like compressed
+   * volumes.
+   *
+   * @code
+   * typedef MemoryMappedImage< DGtal::uint16_t, Z3i::Domain > Image;
+   * Image image = RawReader< Image >::mapRaw< DGtal::uint16_t >( "data.raw", extent );
+   * @endcode
+   *
+   * @tparam TValue the type of the values, which must be trivially copyable.
+   * @tparam TDomain the type of the domain, an HyperRectDomain.
+   *
+   * @see VolReader::mapVol, LongvolReader::mapLongvol, RawReader::mapRaw
+   */
+  template <typename TValue, typename TDomain>
+  class MemoryMappedImage
+    : public ArrayImageAdapter< const TValue*, TDomain >
+  {
+    BOOST_STATIC_ASSERT(( std::is_trivially_copyable< TValue >::value ));
+
+    // ----------------------- Types ------------------------------
+  public:
+    typedef MemoryMappedImage< TValue, TDomain >     Self;
+    typedef ArrayImageAdapter< const TValue*, TDomain > Base;
+    typedef TValue                                   Value;
+    typedef TDomain                                  Domain;
+    typedef typename Domain::Point                   Point;
+    typedef typename Domain::Size                    Size;
+    typedef std::vector< Value >                     Buffer;
+
+    /// Byte order of the values in a file.
+    enum ByteOrder {
+      LittleEndianOrder, ///< least significant byte first
+      HostOrder          ///< the byte order of the host
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor. Empty image.
+     */
+    MemoryMappedImage();
+
+    /**
+     * Image whose values are the ones stored in \a file from byte \a
+     * offset. They are used in place, unless they are not aligned or
+     * their byte order is not the one of the host.
+     *
+     * @param file a mapped file, whose ownership is shared.
+     * @param offset the position of the first value in the file.
+     * @param domain the domain of the image.
+     * @param order the byte order of the values in the file.
+     * @throw IOException if the file is too small.
+     */
+    MemoryMappedImage( CountedPtr< MemoryMappedFile > file,
+                       std::size_t offset,
+                       const Domain & domain,
+                       ByteOrder order = LittleEndianOrder );
+
+    /**
+     * Image whose values are the ones of the buffer \a values, whose
+     * ownership is shared.
+     *
+     * @param values a buffer of (at least) domain.size() values.
+     * @param domain the domain of the image.
+     */
+    MemoryMappedImage( CountedPtr< Buffer > values, const Domain & domain );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// @return a pointer on the values, in column-major order.
+    const Value * data() const;
+
+    /// @return 'true' if the values are read in place from the
+    /// mapped file, 'false' if they were copied or decoded.
+    bool isZeroCopy() const;
+
+    /// @return the mapped file (invalid if the image owns a buffer).
+    CountedPtr< MemoryMappedFile > file() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return 'true' if the host stores integers in little-endian
+     * byte order.
+     */
+    static bool isLittleEndianHost();
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The first value.
+    const Value * myData;
+    /// The mapped file, or null.
+    CountedPtr< MemoryMappedFile > myFile;
+    /// The buffer of values when they are not read in place, or null.
+    CountedPtr< Buffer > myValues;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /// Delegated constructor: uses \a values if not null, the file otherwise.
+    MemoryMappedImage( CountedPtr< MemoryMappedFile > file,
+                       std::size_t offset,
+                       const Domain & domain,
+                       CountedPtr< Buffer > values );
+
+    /**
+     * @return a buffer with the values of \a file from \a offset when
+     * they cannot be read in place, a null pointer otherwise.
+     */
+    static CountedPtr< Buffer >
+    copyIfNeeded( const CountedPtr< MemoryMappedFile > & file,
+                  std::size_t offset, const Domain & domain,
+                  ByteOrder order );
+
+  }; // end of class MemoryMappedImage
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MemoryMappedImage'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MemoryMappedImage' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TValue, typename TDomain>
+  std::ostream&
+  operator<< ( std::ostream & out, const MemoryMappedImage<TValue, TDomain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/MemoryMappedImage.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MemoryMappedImage_h
+
+#undef MemoryMappedImage_RECURSES
+#endif // else defined(MemoryMappedImage_RECURSES)
@@ -0,0 +1,186 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file OverflowTable.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for the overflow table of compact image containers.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(OverflowTable_RECURSES)
+#error Recursive header files inclusion detected in OverflowTable.h
+#else // defined(OverflowTable_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define OverflowTable_RECURSES
+
+#if !defined OverflowTable_h
+/** Prevents repeated inclusion of headers. */
+#define OverflowTable_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OverflowTable
+  /**
+   * Description of template class 'OverflowTable' <p>
+   * \brief Aim: Stores the values of a compact image container
+   * (ImageContainerByPointOffsets, ImageContainerBySiteIndices) that
+   * do not fit in its compact encoding, indexed by linearized point.
+   *
+   * The table is split into NB_SHARDS shards chosen by index, each
+   * protected by its own mutex, so that it can be read and written
+   * concurrently at distinct indices and that threads rarely wait for
+   * each other.
+   *
+   * @tparam TValue the type of stored values.
+   */
+  template < typename TValue >
+  class OverflowTable
+  {
+  public:
+    typedef TValue      Value;
+    typedef std::size_t Size;
+
+    /// Number of shards of the table.
+    static const Size NB_SHARDS = 64;
+
+    /// Constructor. The table is empty.
+    OverflowTable() : myShards( NB_SHARDS ) {}
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    OverflowTable( const OverflowTable & other ) : myShards( NB_SHARDS )
+    {
+      *this = other;
+    }
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    OverflowTable & operator=( const OverflowTable & other )
+    {
+      if ( this != &other )
+        for ( Size i = 0; i < NB_SHARDS; ++i )
+          {
+            std::lock_guard< std::mutex > lock( other.myShards[ i ].mutex );
+            myShards[ i ].values = other.myShards[ i ].values;
+          }
+      return *this;
+    }
+
+    /**
+     * @pre a value is stored at index \a idx.
+     * @param idx any index.
+     * @return the value stored at index \a idx.
+     */
+    Value get( Size idx ) const
+    {
+      const Shard & s = myShards[ idx % NB_SHARDS ];
+      std::lock_guard< std::mutex > lock( s.mutex );
+      return s.values.find( idx )->second;
+    }
+
+    /**
+     * Stores \a v at index \a idx.
+     * @param idx any index.
+     * @param v any value.
+     */
+    void set( Size idx, const Value & v )
+    {
+      Shard & s = myShards[ idx % NB_SHARDS ];
+      std::lock_guard< std::mutex > lock( s.mutex );
+      s.values[ idx ] = v;
+    }
+
+    /**
+     * Removes the value stored at index \a idx, if any.
+     * @param idx any index.
+     */
+    void erase( Size idx )
+    {
+      Shard & s = myShards[ idx % NB_SHARDS ];
+      std::lock_guard< std::mutex > lock( s.mutex );
+      s.values.erase( idx );
+    }
+
+    /// @return the number of stored values.
+    Size size() const
+    {
+      Size n = 0;
+      for ( const auto & s : myShards )
+        {
+          std::lock_guard< std::mutex > lock( s.mutex );
+          n += s.values.size();
+        }
+      return n;
+    }
+
+    /// @return an estimation of the number of bytes used by the table.
+    Size memoryUsage() const
+    {
+      // An unordered_map node holds the pair and a next pointer, plus one bucket.
+      return myShards.size() * sizeof( Shard )
+        + size() * ( sizeof( std::pair< Size, Value > ) + 2 * sizeof( void* ) );
+    }
+
+  private:
+    /// A part of the table, with its own mutex.
+    struct Shard
+    {
+      /// Protects values against concurrent accesses.
+      mutable std::mutex mutex;
+      /// The values of the shard, indexed by linearized point.
+      std::unordered_map< Size, Value > values;
+    };
+
+    /// The shards: the value of index i is in shard i % NB_SHARDS.
+    std::vector< Shard > myShards;
+  }; // end of class OverflowTable
+
+#ifndef _MSC_VER
+  template < typename TValue >
+  const typename OverflowTable< TValue >::Size OverflowTable< TValue >::NB_SHARDS;
+#endif
+
+} // namespace DGtal
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined OverflowTable_h
+
+#undef OverflowTable_RECURSES
+#endif // else defined(OverflowTable_RECURSES)
@@ -0,0 +1,226 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SummedVolumeTable.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module SummedVolumeTable.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SummedVolumeTable_RECURSES)
+#error Recursive header files inclusion detected in SummedVolumeTable.h
+#else // defined(SummedVolumeTable_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SummedVolumeTable_RECURSES
+
+#if !defined SummedVolumeTable_h
+/** Prevents repeated inclusion of headers. */
+#define SummedVolumeTable_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <array>
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <boost/type_traits/is_unsigned.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SummedVolumeTable
+  /**
+   * Description of template class 'SummedVolumeTable' <p>
+   * \brief Aim: A summed volume table (or integral image) of a binary
+   * shape given as a point predicate over an hyper-rectangular domain.
+   * Once built in linear time, it gives the number of shape points
+   * within any axis-aligned box with \f$ 2^d \f$ lookups.
+   *
+   * The table stores exclusive prefix sums in a grid whose extent is
+   * one more than the domain along each axis, so that no boundary
+   * test is needed. Values are unsigned integers and prefix sums are
+   * computed modulo \f$ 2^{bits} \f$: since the inclusion-exclusion
+   * formula only involves additions and subtractions, the count
+   * within a box is exact as long as it fits in \a TValue, whatever
+   * the size of the domain. The default 32 bits value type is thus
+   * enough for any box of less than \f$ 2^{32} \f$ points.
+   *
+   * Combined with a decomposition of a digital kernel into boxes
+   * (see decomposeIntoBoxes), it computes the number of shape points
+   * within a translated kernel in O(#boxes) instead of O(#points).
+   *
+   * @tparam TDomain the type of domain, a HyperRectDomain.
+   * @tparam TValue an unsigned integral type for the counts.
+   *
+   * @see testSummedVolumeTable.cpp
+   */
+  template < typename TDomain, typename TValue = DGtal::uint32_t >
+  class SummedVolumeTable
+  {
+  public:
+    typedef SummedVolumeTable< TDomain, TValue > Self;
+    typedef TDomain                              Domain;
+    typedef TValue                               Value;
+    typedef typename Domain::Space               Space;
+    typedef typename Domain::Point               Point;
+    typedef typename Space::Dimension            Dimension;
+    /// An axis-aligned box, given by its lowest and uppermost points (included).
+    typedef std::pair< Point, Point >            Box;
+    static const Dimension dimension = Space::dimension;
+
+    BOOST_STATIC_ASSERT(( boost::is_unsigned< Value >::value ));
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor. The object is invalid.
+     */
+    SummedVolumeTable();
+
+    /**
+     * Constructor from a point predicate.
+     *
+     * @tparam TPointPredicate a model of concepts::CPointPredicate.
+     * @param aDomain the domain where the predicate is sampled.
+     * @param aPredicate the characteristic function of the shape.
+     */
+    template < typename TPointPredicate >
+    SummedVolumeTable( const Domain& aDomain, const TPointPredicate& aPredicate );
+
+    /**
+     * (Re)builds the table from a point predicate, in time linear in
+     * the number of points of \a aDomain.
+     *
+     * @tparam TPointPredicate a model of concepts::CPointPredicate.
+     * @param aDomain the domain where the predicate is sampled.
+     * @param aPredicate the characteristic function of the shape.
+     */
+    template < typename TPointPredicate >
+    void init( const Domain& aDomain, const TPointPredicate& aPredicate );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// @return the domain of the table.
+    const Domain& domain() const;
+
+    /**
+     * @param lo the lowest point of the box.
+     * @param hi the uppermost point of the box.
+     * @return the number of shape points within the box [lo,hi]
+     * intersected with the domain.
+     */
+    Value sum( const Point& lo, const Point& hi ) const;
+
+    /**
+     * @param box any box.
+     * @param shift a translation vector.
+     * @return the number of shape points within the box translated by
+     * \a shift, intersected with the domain.
+     */
+    Value sum( const Box& box, const Point& shift ) const;
+
+    /**
+     * @tparam TBoxIterator a forward iterator on Box.
+     * @param itb an iterator on the first box of a set of disjoint boxes.
+     * @param ite an iterator after the last box.
+     * @param shift a translation vector.
+     * @return the number of shape points within the union of the
+     * (disjoint) boxes translated by \a shift.
+     */
+    template < typename TBoxIterator >
+    Value sum( TBoxIterator itb, TBoxIterator ite, const Point& shift ) const;
+
+    /**
+     * Decomposes a set of digital points into a set of disjoint
+     * axis-aligned boxes whose union is the given set. Points are
+     * first gathered into maximal runs along the first axis, then
+     * boxes are merged along each other axis in turn. For a digital
+     * ball of radius r, it gives \f$ O(r^{d-1}) \f$ boxes.
+     *
+     * @tparam TPointIterator a forward iterator on Point.
+     * @param itb an iterator on the first point of the set.
+     * @param ite an iterator after the last point of the set.
+     * @return the boxes.
+     */
+    template < typename TPointIterator >
+    static std::vector< Box > decomposeIntoBoxes( TPointIterator itb, TPointIterator ite );
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The domain of the table.
+    Domain myDomain;
+    /// The strides of the (padded) table along each axis.
+    std::array< std::size_t, dimension > myStrides;
+    /// The exclusive prefix sums (padded with zeroes).
+    std::vector< Value > myTable;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /// @return the index in myTable of the table point \a p (already padded).
+    std::size_t index( const Point& p ) const;
+
+  }; // end of class SummedVolumeTable
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SummedVolumeTable'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SummedVolumeTable' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TDomain, typename TValue >
+  std::ostream&
+  operator<< ( std::ostream & out, const SummedVolumeTable< TDomain, TValue > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/SummedVolumeTable.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SummedVolumeTable_h
+
+#undef SummedVolumeTable_RECURSES
+#endif // else defined(SummedVolumeTable_RECURSES)
@@ -48,6 +48,7 @@
 #include <boost/static_assert.hpp>
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/images/MemoryMappedImage.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -84,6 +85,8 @@ namespace DGtal
    * @tparam TImageContainer the image container to use.
    * @tparam TFunctor the type of functor used in the import (by default set to functors::Cast< TImageContainer::Value>).
    *
+   * Use mapLongvol to access the voxels without copying them.
+   *
    * @see testLongvol.cpp
    */
   template <typename TImageContainer,
@@ -113,35 +116,28 @@ namespace DGtal
      */
     static ImageContainer importLongvol(const std::string & filename,
                                         const Functor & aFunctor =  Functor());
-    
-    
-    
-  private:
-    
+
+    /// Type of the read-only image returned by mapLongvol.
+    typedef MemoryMappedImage< DGtal::uint64_t, typename ImageContainer::Domain > MappedImage;
+
     /**
-     * Generic read word (binary mode) in little-endian mode.
-     *
-     * @param fin input stream.
-     * @param aValue value to write.
+     * Maps a Longvol file in memory and returns a read-only image on
+     * its voxels. Voxels of uncompressed files (Version 2) are read in
+     * place from the mapping when the host is little-endian and they
+     * are 8-bytes aligned in the file, otherwise they are copied once;
+     * compressed files (Version 3) are uncompressed at once into a
+     * buffer owned by the image. The file remains mapped as long as
+     * the returned image (or one of its copies) lives.
      *
-     * @return modified stream.
+     * @param filename the file name to import.
+     * @return a model of concepts::CConstImage on the voxels of the file.
      */
-    template <typename Word>
-    static
-    std::stringstream& read_word( std::stringstream & fin, Word& aValue )
-    {
-      aValue = 0;
-      char c;
-      for (unsigned int size = 0; size < sizeof( Word ); ++size)
-      {
-        fin.get( c ) ;
-        unsigned char cc=static_cast<unsigned char>(c);
-        aValue |= (cc << (8 * size));
-      }
-      return fin;
-    }
+    static MappedImage mapLongvol( const std::string & filename );
     
     
+    
+  private:
+    
     typedef unsigned char voxel;
     /** This class help us to associate a field type and his value.
      * An object is a pair (type, value). You can copy and assign
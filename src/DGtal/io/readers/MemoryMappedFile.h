@@ -0,0 +1,160 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MemoryMappedFile.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module MemoryMappedFile.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MemoryMappedFile_RECURSES)
+#error Recursive header files inclusion detected in MemoryMappedFile.h
+#else // defined(MemoryMappedFile_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MemoryMappedFile_RECURSES
+
+#if !defined MemoryMappedFile_h
+/** Prevents repeated inclusion of headers. */
+#define MemoryMappedFile_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class MemoryMappedFile
+  /**
+   * Description of class 'MemoryMappedFile' <p>
+   * \brief Aim: gives a read-only access to the content of a file
+   * through a pointer, the file being mapped in memory.
+   *
+   * On POSIX systems, the file is mapped with `mmap`: its pages are
+   * loaded lazily by the system, and nothing is copied nor allocated
+   * by the process. Elsewhere, the file is read at once into a buffer.
+   * The mapping lives as long as the object, which is not copyable:
+   * share it through a CountedPtr (see MemoryMappedImage).
+   *
+   * @code
+   * MemoryMappedFile file( "data.raw" );
+   * const char* bytes = file.data(); // file.size() bytes
+   * @endcode
+   *
+   * @see MemoryMappedImage, VolReader, LongvolReader, RawReader
+   */
+  class MemoryMappedFile
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Maps the file \a filename in memory.
+     * @param filename the name of the file.
+     * @throw IOException if the file cannot be opened or mapped.
+     */
+    explicit MemoryMappedFile( const std::string & filename );
+
+    /**
+     * Destructor. Unmaps the file.
+     */
+    ~MemoryMappedFile();
+
+    /// Copy constructor (deleted).
+    MemoryMappedFile( const MemoryMappedFile & other ) = delete;
+
+    /// Copy assignment operator (deleted).
+    MemoryMappedFile & operator=( const MemoryMappedFile & other ) = delete;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// @return a pointer on the first byte of the file (0 if empty).
+    const char * data() const;
+
+    /// @return the number of bytes of the file.
+    std::size_t size() const;
+
+    /// @return the name of the mapped file.
+    const std::string & filename() const;
+
+    /// @return 'true' if the file is really mapped in memory,
+    /// 'false' if it was read into a buffer.
+    bool isMapped() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The name of the file.
+    std::string myFilename;
+    /// The first byte of the file.
+    const char * myData;
+    /// The number of bytes of the file.
+    std::size_t mySize;
+    /// Tells if myData points on a memory mapping.
+    bool myMapped;
+    /// The content of the file, when it is not mapped.
+    std::vector<char> myBuffer;
+
+  }; // end of class MemoryMappedFile
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MemoryMappedFile'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MemoryMappedFile' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const MemoryMappedFile & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/MemoryMappedFile.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MemoryMappedFile_h
+
+#undef MemoryMappedFile_RECURSES
+#endif // else defined(MemoryMappedFile_RECURSES)
@@ -45,6 +45,7 @@
 #include <cstdio>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/images/MemoryMappedImage.h"
 #include <boost/static_assert.hpp>
 //////////////////////////////////////////////////////////////////////////////
 
@@ -63,6 +64,8 @@ namespace DGtal
    * even structures.
    *
    * All these methods return an instance of the template parameter \c TImageContainer. A functor can be specified to convert raw values to image values.
+   * The method \c mapRaw instead returns a read-only image on the values of the
+   * memory mapped file, without copying them (see MemoryMappedImage).
    *
    * Example usage:
    * @code
@@ -118,6 +121,23 @@ namespace DGtal
              const Vector & extent,
              const Functor & aFunctor =  Functor());
 
+    /**
+     * Maps a Raw file in memory and returns a read-only image on its
+     * values. Like the other import methods, values are read in the
+     * byte order of the host, the one used by RawWriter. They are read
+     * in place from the mapping (copied once only if they are not
+     * aligned). The file remains mapped as long as the returned image
+     * (or one of its copies) lives.
+     *
+     * @tparam Word read pixel type.
+     * @param filename the file name to import.
+     * @param extent the size of the raw data set.
+     * @return a model of concepts::CConstImage on the values of the file.
+     */
+    template <typename Word>
+    static MemoryMappedImage< Word, typename ImageContainer::Domain >
+    mapRaw(const std::string & filename, const Vector & extent);
+
     /**
      * Method to import a Raw (unsigned 8bits little endian, uint8_t, unsigned char) into an instance of the
      * template parameter ImageContainer.
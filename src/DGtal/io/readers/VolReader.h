@@ -46,6 +46,7 @@
 #include <cstdio>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/images/MemoryMappedImage.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -82,6 +83,8 @@ namespace DGtal
    * @tparam TImageContainer the image container to use. 
    *
    * @tparam TFunctor the type of functor used in the import (by default set to functors::Cast< TImageContainer::Value>) .
+   * Use mapVol to access the voxels without copying them.
+   *
    * @see testVolReader.cpp
    */
   template <typename TImageContainer,  
@@ -113,6 +116,27 @@ namespace DGtal
      */
     static ImageContainer importVol(const std::string & filename, 
                                     const Functor & aFunctor =  Functor());
+
+    /// Type of the read-only image returned by mapVol.
+    typedef MemoryMappedImage< unsigned char, typename ImageContainer::Domain > MappedImage;
+
+    /**
+     * Maps a Vol file in memory and returns a read-only image on its
+     * voxels. Voxels of uncompressed files (Version 2) are read in
+     * place from the mapping, without any copy; compressed files
+     * (Version 3) are uncompressed at once into a buffer owned by the
+     * image. The file remains mapped as long as the returned image
+     * (or one of its copies) lives.
+     *
+     * @code
+     * auto image = VolReader<Image>::mapVol( "data.vol" );
+     * trace.info() << image( Z3i::Point( 10, 5, 3 ) ) << std::endl;
+     * @endcode
+     *
+     * @param filename the file name to import.
+     * @return a model of concepts::CConstImage on the voxels of the file.
+     */
+    static MappedImage mapVol( const std::string & filename );
     
   private:
 
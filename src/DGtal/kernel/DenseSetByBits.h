@@ -0,0 +1,595 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DenseSetByBits.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module DenseSetByBits
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DenseSetByBits_RECURSES)
+#error Recursive header files inclusion detected in DenseSetByBits.h
+#else // defined(DenseSetByBits_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DenseSetByBits_RECURSES
+
+#if !defined DenseSetByBits_h
+/** Prevents repeated inclusion of headers. */
+#define DenseSetByBits_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DenseSetByBits
+  /**
+   * Description of template class 'DenseSetByBits' <p>
+   * \brief Aim: a set of digital points stored as one bit per point of
+   * their bounding box. It has the interface of a std::set (model of
+   * concepts::CSTLAssociativeContainer), so that it can be used in a
+   * DigitalSetByAssociativeContainer.
+   *
+   * The bits are grouped by rows along the first axis, each row
+   * spanning a whole number of 64 bits words, and the rows are
+   * stored in lexicographic order of their remaining coordinates.
+   * Membership tests and insertions are thus a few arithmetic
+   * operations, and traversals skip 64 absent points at once. Points
+   * are visited in increasing order of their last coordinate, then
+   * of the previous one, and so on.
+   *
+   * The box grows as needed when a point outside is inserted (at
+   * least doubling its size along the axes where it grows), hence the
+   * memory is proportional to the bounding box of the points and not
+   * to the domain of the set. This data structure is thus adapted to
+   * big sets that fill a good part of their bounding box, and wastes
+   * memory for sparse sets.
+   *
+   * @note Like for std::vector, an insertion that makes the box grow
+   * invalidates all iterators.
+   *
+   * @code
+   * DGtal::DenseSetByBits< Z3i::Point > aSet;
+   * aSet.insert( Z3i::Point( 1, 2, 3 ) );
+   * bool in = aSet.count( Z3i::Point( 1, 2, 3 ) ) == 1;
+   * @endcode
+   *
+   * @tparam TPoint the type of digital point, whose coordinates are
+   * built-in integers.
+   *
+   * @see DigitalSetSelector, UnorderedSetByBlock
+   */
+  template <typename TPoint>
+  class DenseSetByBits
+  {
+    BOOST_STATIC_ASSERT(( std::is_integral< typename TPoint::Coordinate >::value ));
+
+  public:
+    typedef DenseSetByBits< TPoint >     Self;
+    typedef TPoint                       Point;
+    typedef typename Point::Coordinate   Coordinate;
+    typedef DGtal::uint64_t              Word;
+    static const Dimension dimension = Point::dimension;
+
+    // Standard types
+    /// Key
+    typedef Point key_type;
+    /// Key
+    typedef Point value_type;
+    /// Unsigned integer type
+    typedef std::size_t size_type;
+    /// Signed integer type
+    typedef std::ptrdiff_t difference_type;
+    /// Reference to value_type (elements are not modifiable).
+    typedef const Point& reference;
+    /// Const reference to value_type
+    typedef const Point& const_reference;
+    /// Pointer to value_type (elements are not modifiable).
+    typedef const Point* pointer;
+    /// Const pointer to value_type
+    typedef const Point* const_pointer;
+
+    /// Number of bits per word.
+    static const size_type bitsPerWord = 64;
+
+    // ---------------------- iterators --------------------------------
+
+    /// Read iterator on set elements. Model of ForwardIterator.
+    struct const_iterator
+      : public boost::iterator_facade< const_iterator, Point const,
+                                       boost::forward_traversal_tag,
+                                       Point const& >
+    {
+      friend class DenseSetByBits< TPoint >;
+
+      /// Default constructor
+      const_iterator()
+        : collection( nullptr ), word( 0 ), current( 0 ), row( 0 ), point() {}
+
+      /// Constructor at the first set bit of \a aCurrent, or after.
+      /// @param aSet the visited set.
+      /// @param aWord the index of the word containing \a aCurrent.
+      /// @param aCurrent the bits of this word still to visit.
+      const_iterator( const Self& aSet, size_type aWord, Word aCurrent )
+        : collection( &aSet ), word( aWord ), current( aCurrent ),
+          row( size_type( -1 ) ), point()
+      {
+        normalize();
+      }
+
+    private:
+      friend class boost::iterator_core_access;
+
+      /// Goes to the first set bit of the remaining ones, possibly in
+      /// a following word, and updates the current point.
+      void normalize()
+      {
+        const std::vector<Word>& words = collection->my_words;
+        while ( current == 0 )
+          {
+            if ( ++word >= words.size() )
+              {
+                word = words.size();
+                return;
+              }
+            current = words[ word ];
+          }
+        const size_type wpr = collection->my_words_per_row;
+        const size_type r   = word / wpr;
+        if ( r != row )
+          {
+            row   = r;
+            point = collection->rowPoint( r );
+          }
+        point[ 0 ] = collection->my_lower[ 0 ]
+          + static_cast<Coordinate>( ( word - r * wpr ) * bitsPerWord
+                                     + Bits::leastSignificantBit( current ) );
+      }
+
+      void increment()
+      {
+        ASSERT( current != 0 && "Invalid increment on const_iterator" );
+        current &= current - 1;
+        normalize();
+      }
+
+      bool equal( const const_iterator & other ) const
+      {
+        return word == other.word && current == other.current;
+      }
+
+      const Point& dereference() const
+      {
+        return point;
+      }
+
+      /// the collection that this iterator is traversing.
+      const Self* collection;
+      /// the index of the current word.
+      size_type   word;
+      /// the current word, where visited bits have been erased.
+      Word        current;
+      /// the row of the current point.
+      size_type   row;
+      /// the current point.
+      Point       point;
+    };
+
+    /// Elements are not modifiable, iterators are the const ones.
+    typedef const_iterator iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor. Empty set with an empty box.
+    DenseSetByBits()
+      : my_lower(), my_upper(), my_words_per_row( 0 ), my_words(), my_size( 0 )
+    {}
+
+    /**
+     * Constructor. Empty set whose box is initially [lower,upper],
+     * for instance the domain of the set. The box may grow afterwards.
+     * @param lower the lowest point of the box.
+     * @param upper the highest point of the box.
+     */
+    DenseSetByBits( const Point & lower, const Point & upper )
+      : DenseSetByBits()
+    {
+      reserve( lower, upper );
+    }
+
+    // ----------------------- Iterator services ------------------------------
+  public:
+
+    /// @return an iterator on the first element.
+    const_iterator begin() const
+    {
+      return my_words.empty() ? end()
+        : const_iterator( *this, 0, my_words[ 0 ] );
+    }
+
+    /// @return an iterator after the last element.
+    const_iterator end() const
+    {
+      const_iterator it;
+      it.collection = this;
+      it.word       = my_words.size();
+      return it;
+    }
+
+    /// @return an iterator on the first element.
+    const_iterator cbegin() const { return begin(); }
+
+    /// @return an iterator after the last element.
+    const_iterator cend() const { return end(); }
+
+    // ----------------------- Capacity services ------------------------------
+  public:
+
+    /// @return 'true' iff the set is empty.
+    bool empty() const { return my_size == 0; }
+
+    /// @return the number of elements.
+    size_type size() const { return my_size; }
+
+    /// @return the maximum number of elements.
+    size_type max_size() const { return my_words.max_size(); }
+
+    /// @return the lowest point of the box.
+    const Point & lowerBound() const { return my_lower; }
+
+    /// @return the highest point of the box.
+    const Point & upperBound() const { return my_upper; }
+
+    /// @return an evaluation of the memory usage of this data structure.
+    size_type memory_usage() const
+    {
+      return sizeof( Self ) + my_words.capacity() * sizeof( Word );
+    }
+
+    // ----------------------- Modifier services ------------------------------
+  public:
+
+    /// Clears the set. Like the capacity of a std::vector, the box
+    /// and its memory are kept.
+    void clear()
+    {
+      std::fill( my_words.begin(), my_words.end(), Word( 0 ) );
+      my_size = 0;
+    }
+
+    /// Exchanges the contents of this set with \a other.
+    /// @param other the other set.
+    void swap( Self & other )
+    {
+      std::swap( my_lower, other.my_lower );
+      std::swap( my_upper, other.my_upper );
+      std::swap( my_words_per_row, other.my_words_per_row );
+      my_words.swap( other.my_words );
+      std::swap( my_size, other.my_size );
+    }
+
+    /**
+     * Makes the box contain [lower,upper], elements are kept.
+     * @param lower the lowest point.
+     * @param upper the highest point.
+     */
+    void reserve( const Point & lower, const Point & upper )
+    {
+      if ( ! lower.isLower( upper ) ) return;
+      if ( my_words.empty() ) resize( lower, upper );
+      else if ( ! ( isInside( lower ) && isInside( upper ) ) )
+        resize( my_lower.inf( lower ), my_upper.sup( upper ) );
+    }
+
+    /**
+     * Inserts \a value in the set.
+     * @param value any point.
+     * @return a pair made of an iterator on the point and 'true' if
+     * it was not already in the set.
+     */
+    std::pair< iterator, bool > insert( const value_type & value )
+    {
+      if ( ! isInside( value ) ) grow( value );
+      const std::pair< size_type, Word > wb = location( value );
+      Word & w = my_words[ wb.first ];
+      const bool exist = ( w & wb.second ) != 0;
+      if ( ! exist )
+        {
+          w |= wb.second;
+          my_size += 1;
+        }
+      return std::make_pair( at( wb, value ), ! exist );
+    }
+
+    /**
+     * Inserts \a value in the set, like insert( value ). The hint is
+     * ignored, it is only here for compatibility with std::set.
+     * @param value any point.
+     * @return an iterator on the point.
+     */
+    iterator insert( const_iterator /* hint */, const value_type & value )
+    {
+      return insert( value ).first;
+    }
+
+    /**
+     * Inserts the elements of the range [first, last) into the set.
+     * @param first an input iterator on the first element.
+     * @param last an input iterator after the last element.
+     */
+    template <typename InputIterator>
+    void insert( InputIterator first, InputIterator last )
+    {
+      for ( ; first != last; ++first ) insert( *first );
+    }
+
+    /**
+     * Removes \a key from the set.
+     * @param key any point.
+     * @return the number of removed elements (0 or 1).
+     */
+    size_type erase( const key_type & key )
+    {
+      if ( ! isInside( key ) ) return 0;
+      const std::pair< size_type, Word > wb = location( key );
+      Word & w = my_words[ wb.first ];
+      if ( ( w & wb.second ) == 0 ) return 0;
+      w &= ~wb.second;
+      my_size -= 1;
+      return 1;
+    }
+
+    /**
+     * Removes the element pointed by \a pos.
+     * @param pos a dereferenceable iterator in this set.
+     * @return an iterator on the following element.
+     */
+    iterator erase( const_iterator pos )
+    {
+      ASSERT( pos.collection == this && pos != end() );
+      const Word bit = pos.current & ( ~pos.current + 1 );
+      ASSERT( ( my_words[ pos.word ] & bit ) != 0 );
+      my_words[ pos.word ] &= ~bit;
+      my_size -= 1;
+      return const_iterator( *this, pos.word, pos.current & ~bit );
+    }
+
+    /**
+     * Removes the elements in the range [first, last).
+     * @param first an iterator in this set.
+     * @param last an iterator in this set, after \a first.
+     * @return an iterator on the element following the removed ones.
+     */
+    iterator erase( const_iterator first, const_iterator last )
+    {
+      while ( first != last ) first = erase( first );
+      return first;
+    }
+
+    // ----------------------- Lookup services ------------------------------
+  public:
+
+    /**
+     * @param key any point.
+     * @return an iterator on \a key if it is in the set, end() otherwise.
+     */
+    const_iterator find( const key_type & key ) const
+    {
+      if ( ! isInside( key ) ) return end();
+      const std::pair< size_type, Word > wb = location( key );
+      return ( my_words[ wb.first ] & wb.second ) != 0 ? at( wb, key ) : end();
+    }
+
+    /**
+     * @param key any point.
+     * @return the number of elements equal to \a key (0 or 1).
+     */
+    size_type count( const key_type & key ) const
+    {
+      if ( ! isInside( key ) ) return 0;
+      const std::pair< size_type, Word > wb = location( key );
+      return ( my_words[ wb.first ] & wb.second ) != 0 ? 1 : 0;
+    }
+
+    /**
+     * @param key any point.
+     * @return the range of elements equal to \a key.
+     */
+    std::pair< const_iterator, const_iterator >
+    equal_range( const key_type & key ) const
+    {
+      const_iterator first = find( key );
+      const_iterator last  = first;
+      if ( last != end() ) ++last;
+      return std::make_pair( first, last );
+    }
+
+    /**
+     * @param other any other set.
+     * @return 'true' iff the two sets have the same elements.
+     */
+    bool operator==( const Self & other ) const
+    {
+      if ( size() != other.size() ) return false;
+      for ( const_iterator it = begin(), itE = end(); it != itE; ++it )
+        if ( other.count( *it ) == 0 ) return false;
+      return true;
+    }
+
+    /**
+     * @param other any other set.
+     * @return 'true' iff the two sets have different elements.
+     */
+    bool operator!=( const Self & other ) const
+    {
+      return ! ( *this == other );
+    }
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /// @return 'true' if \a p lies in the box.
+    bool isInside( const Point & p ) const
+    {
+      if ( my_words.empty() ) return false;
+      for ( Dimension k = 0; k < dimension; ++k )
+        if ( p[ k ] < my_lower[ k ] || my_upper[ k ] < p[ k ] ) return false;
+      return true;
+    }
+
+    /// @return the index of the first word of row \a p (first coordinate ignored).
+    size_type rowIndex( const Point & p ) const
+    {
+      size_type r = 0;
+      for ( Dimension k = dimension - 1; k > 0; --k )
+        r = r * size_type( my_upper[ k ] - my_lower[ k ] + 1 )
+          + size_type( p[ k ] - my_lower[ k ] );
+      return r;
+    }
+
+    /// @return the point of row \a r whose first coordinate is unspecified.
+    Point rowPoint( size_type r ) const
+    {
+      Point p;
+      for ( Dimension k = 1; k < dimension; ++k )
+        {
+          const size_type e = size_type( my_upper[ k ] - my_lower[ k ] + 1 );
+          p[ k ] = my_lower[ k ] + static_cast<Coordinate>( r % e );
+          r /= e;
+        }
+      return p;
+    }
+
+    /// @return the index of the word of \a p and the mask of its bit.
+    std::pair< size_type, Word > location( const Point & p ) const
+    {
+      const size_type x = size_type( p[ 0 ] - my_lower[ 0 ] );
+      return std::make_pair( rowIndex( p ) * my_words_per_row + x / bitsPerWord,
+                             Word( 1 ) << ( x % bitsPerWord ) );
+    }
+
+    /// @return an iterator on the point \a p at location \a wb.
+    const_iterator at( const std::pair< size_type, Word > & wb,
+                       const Point & p ) const
+    {
+      const_iterator it;
+      it.collection = this;
+      it.word       = wb.first;
+      it.current    = my_words[ wb.first ] & ~( wb.second - 1 );
+      it.row        = wb.first / my_words_per_row;
+      it.point      = p;
+      return it;
+    }
+
+    /// Makes the box contain \a p, at least doubling it along the
+    /// axes where it grows.
+    void grow( const Point & p )
+    {
+      if ( my_words.empty() ) { resize( p, p ); return; }
+      Point lower = my_lower;
+      Point upper = my_upper;
+      for ( Dimension k = 0; k < dimension; ++k )
+        {
+          const Coordinate e = my_upper[ k ] - my_lower[ k ] + 1;
+          if ( p[ k ] < my_lower[ k ] ) lower[ k ] = std::min( p[ k ], my_lower[ k ] - e );
+          if ( p[ k ] > my_upper[ k ] ) upper[ k ] = std::max( p[ k ], my_upper[ k ] + e );
+        }
+      resize( lower, upper );
+    }
+
+    /// Sets the box to [lower,upper], which contains the elements.
+    void resize( const Point & lower, const Point & upper )
+    {
+      Self other;
+      other.my_lower = lower;
+      other.my_upper = upper;
+      other.my_words_per_row =
+        ( size_type( upper[ 0 ] - lower[ 0 ] ) + bitsPerWord ) / bitsPerWord;
+      size_type nb_rows = 1;
+      for ( Dimension k = 1; k < dimension; ++k )
+        nb_rows *= size_type( upper[ k ] - lower[ k ] + 1 );
+      other.my_words.resize( nb_rows * other.my_words_per_row, 0 );
+      for ( const_iterator it = begin(), itE = end(); it != itE; ++it )
+        {
+          const std::pair< size_type, Word > wb = other.location( *it );
+          other.my_words[ wb.first ] |= wb.second;
+        }
+      other.my_size = my_size;
+      swap( other );
+    }
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The lowest point of the box.
+    Point my_lower;
+    /// The highest point of the box.
+    Point my_upper;
+    /// The number of words per row.
+    size_type my_words_per_row;
+    /// The bits of the box, row after row.
+    std::vector<Word> my_words;
+    /// The number of elements.
+    size_type my_size;
+
+  }; // end of class DenseSetByBits
+
+  /// Swaps in O(1) the given two sets.
+  /// @param s1 a set.
+  /// @param s2 another set.
+  template <typename TPoint>
+  void swap( DenseSetByBits< TPoint > & s1, DenseSetByBits< TPoint > & s2 )
+  {
+    s1.swap( s2 );
+  }
+
+  /// Reserves the box of a set to the bounds of its domain, so that
+  /// a DigitalSetByAssociativeContainer never makes it grow.
+  /// @param aSet a set.
+  /// @param lower the lowest point of the domain.
+  /// @param upper the highest point of the domain.
+  template <typename TPoint>
+  void reserveForDomain( DenseSetByBits< TPoint > & aSet,
+                         const TPoint & lower, const TPoint & upper )
+  {
+    aSet.reserve( lower, upper );
+  }
+
+} // namespace DGtal
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DenseSetByBits_h
+
+#undef DenseSetByBits_RECURSES
+#endif // else defined(DenseSetByBits_RECURSES)
@@ -200,7 +200,7 @@ namespace DGtal
     struct const_iterator
       : public boost::iterator_facade< const_iterator, Key const,
                                        boost::forward_traversal_tag,
-                                       Key const >
+                                       Key const& >
     {
       friend struct UnorderedSetByBlock< Key, TSplitter, Hash, KeyEqual >;
       /// Default constructor
@@ -218,6 +218,7 @@ namespace DGtal
           {
             current  = it->second;
             bit      = static_cast<Coordinate>( Bits::leastSignificantBit( current ) );
+            key      = collection->my_splitter.join( it->first, bit );
           }
         else
           {
@@ -238,6 +239,7 @@ namespace DGtal
           {
             current  = it->second;
             current &= ~( ( static_cast<Word>(1) << bit ) - static_cast<Word>(1) );
+            key      = collection->my_splitter.join( it->first, bit );
           }
         else
           current = static_cast<Word>(0);
@@ -254,6 +256,7 @@ namespace DGtal
         if ( it != collection->my_elements.cend() )
           {
             bit     = se.second;
+            this->key = key;
             current = it->second & ~( (static_cast<Word>(1) << bit )
                                       - static_cast<Word>(1) );
           }
@@ -278,6 +281,7 @@ namespace DGtal
               {
                 current = it->second;
                 bit     = static_cast<Coordinate>(Bits::leastSignificantBit( current ));
+                key     = collection->my_splitter.join( it->first, bit );
               }
             else
               {
@@ -286,7 +290,10 @@ namespace DGtal
               }
           }
         else
-          bit = static_cast<Coordinate>(Bits::leastSignificantBit( current ));
+          {
+            bit = static_cast<Coordinate>(Bits::leastSignificantBit( current ));
+            key = collection->my_splitter.join( it->first, bit );
+          }
       }
 
       bool equal( const const_iterator & other ) const
@@ -295,9 +302,9 @@ namespace DGtal
         return it == other.it && bit == other.bit;
       }
 
-      const Key dereference() const
+      const Key& dereference() const
       {
-        return collection->my_splitter.join( it->first, bit );
+        return key;
       }
 
       /// the collection that this iterator is traversing.
@@ -308,6 +315,8 @@ namespace DGtal
       Coordinate                   bit;
       /// the current value of the block, where visited bits have been erased.
       Word                         current;
+      /// the current element, when the iterator is dereferenceable.
+      Key                          key;
 
     };
 
@@ -315,7 +324,7 @@ namespace DGtal
     struct iterator
       : public boost::iterator_facade< iterator, Key const,
                                        boost::forward_traversal_tag,
-                                       Key const >
+                                       Key const& >
     {
       friend struct UnorderedSetByBlock< Key, TSplitter, Hash, KeyEqual >;
       /// Default constructor
@@ -333,6 +342,7 @@ namespace DGtal
           {
             current  = it->second;
             bit      = static_cast<Coordinate>(Bits::leastSignificantBit( current ));
+            key      = collection->my_splitter.join( it->first, bit );
           }
         else
           {
@@ -353,6 +363,7 @@ namespace DGtal
             current  = it->second;
             current &= ~( ( static_cast<Word>(1) << bit )
                           - static_cast<Word>(1) );
+            key      = collection->my_splitter.join( it->first, bit );
           }
         else
           current = static_cast<Word>(0);
@@ -371,6 +382,7 @@ namespace DGtal
         if ( it != collection->my_elements.end() )
           {
             bit     = se.second;
+            this->key = key;
             current = it->second & ~( (static_cast<Word>(1) << bit )
                                       - static_cast<Word>(1) );
           }
@@ -385,7 +397,7 @@ namespace DGtal
       /// @param other any const_iterator
       iterator( const const_iterator& other )
         : collection( other.collection ), it( other.it ),
-          bit( other.bit ), current( other.current )
+          bit( other.bit ), current( other.current ), key( other.key )
       {}
 
       /// Move constructor from const_iterator
@@ -394,7 +406,8 @@ namespace DGtal
         : collection( std::move( other.collection ) ),
           it( std::move( other.it ) ),
           bit( std::move( other.bit ) ),
-          current( std::move( other.current ) )
+          current( std::move( other.current ) ),
+          key( std::move( other.key ) )
       {}
 
       /// Conversation to const_iterator
@@ -418,6 +431,7 @@ namespace DGtal
               {
                 current = it->second;
                 bit     = static_cast<Coordinate>(Bits::leastSignificantBit( current ));
+                key     = collection->my_splitter.join( it->first, bit );
               }
             else
               {
@@ -426,7 +440,10 @@ namespace DGtal
               }
           }
         else
-          bit = static_cast<Coordinate>(Bits::leastSignificantBit( current ));
+          {
+            bit = static_cast<Coordinate>(Bits::leastSignificantBit( current ));
+            key = collection->my_splitter.join( it->first, bit );
+          }
       }
 
       bool equal( const iterator & other ) const
@@ -444,9 +461,9 @@ namespace DGtal
         return it == other.it && bit == other.bit;
       }
 
-      const Key dereference() const
+      const Key& dereference() const
       {
-        return collection->my_splitter.join( it->first, bit );
+        return key;
       }
 
       /// the collection that this iterator is traversing.
@@ -457,6 +474,8 @@ namespace DGtal
       Coordinate                   bit;
       /// the current value of the block, where visited bits have been erased.
       Word                         current;
+      /// the current element, when the iterator is dereferenceable.
+      Key                          key;
 
     };
 
@@ -716,6 +735,30 @@ namespace DGtal
         }
     }
 
+    /**
+     *  @brief Attempts to insert an element into the set, like
+     *  insert( value ). The hint is ignored, it is only here for
+     *  compatibility with std::unordered_set.
+     *  @param  value  Element to be inserted.
+     *  @return An iterator that points to the possibly inserted element.
+     */
+    iterator insert( const_iterator /* hint */, const value_type& value )
+    {
+      return insert( value ).first;
+    }
+
+    /**
+     *  @brief Inserts the elements of the range [first, last) into
+     *  the set.
+     *  @param  first  An input iterator on the first element.
+     *  @param  last   An input iterator after the last element.
+     */
+    template <typename InputIterator>
+    void insert( InputIterator first, InputIterator last )
+    {
+      for ( ; first != last; ++first ) insert( *first );
+    }
+
     /// Removes specified element from the container.
     /// @param pos a valid iterator in this data structure
     /// @return the iterator following the last removed element.
@@ -66,6 +66,15 @@
 namespace DGtal
 {
 
+  /// Prepares an associative container to store the points of the
+  /// domain [lower,upper]. It does nothing by default, and is
+  /// overloaded for containers whose storage depends on a box (see
+  /// DenseSetByBits).
+  template <typename TContainer, typename TPoint>
+  void reserveForDomain( TContainer & /* aSet */,
+                         const TPoint & /* lower */, const TPoint & /* upper */ )
+  {}
+
   /////////////////////////////////////////////////////////////////////////////
   // template class DigitalSetByAssociativeContainer
   /**
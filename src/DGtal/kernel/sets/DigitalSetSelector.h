@@ -45,12 +45,17 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <type_traits>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/DenseSetByBits.h"
+#include "DGtal/kernel/UnorderedSetByBlock.h"
 
 #include "DGtal/kernel/PointHashFunctions.h"
 #include <unordered_set>
+#include <boost/container/flat_set.hpp>
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -62,6 +67,14 @@ namespace DGtal
   enum DigitalSetIterability { LOW_ITER_DS = 0, HIGH_ITER_DS = 8 };
   enum DigitalSetBelongTestability { LOW_BEL_DS = 0, HIGH_BEL_DS = 16 };
 
+  namespace details
+  {
+    /// Defines the associative container of DigitalSetSelector (see
+    /// DigitalSetSelector.ih).
+    template <typename Domain, int Preferences>
+    struct DigitalSetContainerSelector;
+  }
+
   /////////////////////////////////////////////////////////////////////////////
   // template class DigitalSetSelector
   /**
@@ -69,6 +82,35 @@ namespace DGtal
    * Aim: Automatically defines an adequate digital set type according
    * to the hints given by the user.
    *
+   * The hints are the sum of a size (SMALL_DS, MEDIUM_DS, BIG_DS or
+   * WHOLE_DS), of a variability (LOW_VAR_DS or HIGH_VAR_DS), of an
+   * iterability (LOW_ITER_DS or HIGH_ITER_DS) and of a belonging
+   * testability (LOW_BEL_DS or HIGH_BEL_DS). The type is always a
+   * DigitalSetByAssociativeContainer, whose container is:
+   *
+   * - a sorted vector (boost::container::flat_set) for small sets
+   *   with a low variability: it is the most compact and is the
+   *   fastest to traverse, while its logarithmic search and linear
+   *   insertion are cheap for a few points;
+   *
+   * - a DenseSetByBits for sets in an HyperRectDomain that are as big
+   *   as the domain (WHOLE_DS): one bit per point of the domain,
+   *   reserved at construction, with the fastest belonging tests;
+   *
+   * - an UnorderedSetByBlock for big sets in an HyperRectDomain
+   *   without many belonging tests (BIG_DS without HIGH_BEL_DS), which
+   *   may be sparse: hashed blocks of 32 consecutive points along the
+   *   first axis;
+   *
+   * - a std::unordered_set otherwise (e.g. for Z2i::DigitalSet and
+   *   Z3i::DigitalSet, which are BIG_DS + HIGH_BEL_DS), or when points
+   *   have no built-in integer coordinates. Its memory only depends on
+   *   the number of points, whereas a DenseSetByBits would need one
+   *   bit per point of the bounding box of the set.
+   *
+   * The file tests/kernel/benchmarkDigitalSetSelector.cpp compares
+   * these containers.
+   *
    * @code
    typedef SpaceND<int,4> Space4;
    typedef HyperRectDomain<Space4> Domain;
@@ -91,7 +133,9 @@ namespace DGtal
     /**
      * Adequate digital set representation for the given preferences.
      */
-    typedef DigitalSetByAssociativeContainer<Domain, std::unordered_set< typename Domain::Point> > Type;
+    typedef DigitalSetByAssociativeContainer
+    < Domain,
+      typename details::DigitalSetContainerSelector< Domain, Preferences >::Type > Type;
   }; // end of class DigitalSetSelector
 
 
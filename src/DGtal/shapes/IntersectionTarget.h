@@ -112,7 +112,7 @@ namespace DGtal
        * Get definition of the target
        * @return intersection target
        */
-      const std::array<Edge, 3>& operator()() {
+      const std::array<Edge, 3>& operator()() const {
         return myTarget;
       }
 
@@ -121,7 +121,7 @@ namespace DGtal
        * @param i index
        * @return intersection target
        */
-      const Edge& operator()(int i) {
+      const Edge& operator()(int i) const {
         return myTarget[i];
       }
 
@@ -38,6 +38,8 @@
 #include "DGtal/shapes/IntersectionTarget.h"
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/images/ImageContainerByBits.h"
+#include "DGtal/base/ParallelFor.h"
 #include "DGtal/geometry/tools/determinant/PredicateFromOrientationFunctor2.h"
 #include "DGtal/geometry/tools/determinant/InHalfPlaneBySimple3x3Matrix.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -71,6 +73,15 @@ namespace DGtal
    @image html 6-sep.png "Template for 6-separating digitization"
    @image html 26-sep.png "Template for 26-separating digitization"
 
+   A mesh is voxelized into a bit image (ImageContainerByBits)
+   restricted to the bounding box of the mesh, which is split into
+   slabs along the last axis. Faces are binned into the slabs they
+   span, and each slab is voxelized by one thread at a time, which
+   then owns the rows of the slab: there is neither lock nor atomic
+   write on the voxels. The voxels are finally emitted once into the
+   output digital set or image. The result does not depend on the
+   number of threads.
+
 
    @tparam TDigitalSet a DigitalSet (model of concepts::CDigitalSet)
    @tparam Separation strategy of the voxelization (6 or 26)
@@ -102,8 +113,12 @@ namespace DGtal
     using PointZ3  = typename Space::Point;
     using OrientationFunctor = InHalfPlaneBySimple3x3Matrix<PointR2, double>;
     using IntersectionTarget = typename IntersectionTargetTrait<Space, Separation, 1>::Type;
+    using BinaryImage = ImageContainerByBits<Domain>;
     /*********************************************/
 
+    ///Rules deciding which voxels are inside a mesh in solid voxelization.
+    enum FillRule { EVEN_ODD, NON_ZERO };
+
   public:
 
     /**
@@ -126,12 +141,81 @@ namespace DGtal
      * be casted to @e PointR3 points.
      * @param [in] scaleFactor the scale factor to apply to the mesh
      * (default=1.0)
+     * @param [in] nbThreads the number of threads (0 means as many as
+     * the hardware supports, default=1).
      * @tparam MeshPoint the type of point of the mesh.
      */
     template<typename MeshPoint>
     void voxelize(DigitalSet &outputSet,
                   const Mesh<MeshPoint> &aMesh,
-                  const double scaleFactor = 1.0);
+                  const double scaleFactor = 1.0,
+                  unsigned int nbThreads = 1);
+
+    /**
+     * Voxelize the mesh into a binary image: the voxels of the mesh
+     * are set to true, the other values are left unchanged. Voxels
+     * outside the image domain are skipped.
+     *
+     * If the image is BIT_PACKED, the voxels are directly written in
+     * its rows, without any intermediate storage (otherwise it is
+     * temporarily converted).
+     *
+     * @param [in,out] outputImage the image that collects the voxels.
+     * @param [in] aMesh the mesh to voxelize.
+     * @param [in] scaleFactor the scale factor to apply to the mesh
+     * (default=1.0)
+     * @param [in] nbThreads the number of threads (0 means as many as
+     * the hardware supports, default=1).
+     * @tparam MeshPoint the type of point of the mesh.
+     */
+    template<typename MeshPoint>
+    void voxelize(BinaryImage &outputImage,
+                  const Mesh<MeshPoint> &aMesh,
+                  const double scaleFactor = 1.0,
+                  unsigned int nbThreads = 1);
+
+    /**
+     * Voxelize the interior of a closed mesh into a binary image
+     * (solid voxelization): the voxels whose center is inside the
+     * mesh are set to true, the other values are left unchanged.
+     * Voxels outside the image domain are skipped.
+     *
+     * For each row of the image (line along the first axis), a ray
+     * through the centers of its voxels is intersected with the
+     * triangles of the mesh, and the voxels between crossings are
+     * classified by the parity of the number of crossings (EVEN_ODD)
+     * or by the winding number of the mesh around them (NON_ZERO).
+     * Rays passing through edges or vertices are counted once thanks
+     * to a consistent tie-breaking rule. Rows whose crossings do not
+     * close (e.g. through a hole of a non-watertight mesh) are left
+     * unchanged, instead of being filled up to the domain border.
+     *
+     * Rows are processed by slabs along the last axis, each slab by
+     * one thread; the result does not depend on the number of
+     * threads. If the image is BIT_PACKED, the voxels are directly
+     * written in its rows (otherwise it is temporarily converted).
+     *
+     * @note the digitization of the surface itself (see voxelize())
+     * may be added to the image to get a set of voxels covering the
+     * whole mesh.
+     *
+     * @param [in,out] outputImage the image that collects the voxels.
+     * @param [in] aMesh the mesh to voxelize, which should be closed
+     * (and consistently oriented for NON_ZERO).
+     * @param [in] scaleFactor the scale factor to apply to the mesh
+     * (default=1.0)
+     * @param [in] rule the rule deciding which voxels are inside
+     * (default=NON_ZERO).
+     * @param [in] nbThreads the number of threads (0 means as many as
+     * the hardware supports, default=1).
+     * @tparam MeshPoint the type of point of the mesh.
+     */
+    template<typename MeshPoint>
+    void voxelizeSolid(BinaryImage &outputImage,
+                       const Mesh<MeshPoint> &aMesh,
+                       const double scaleFactor = 1.0,
+                       FillRule rule = NON_ZERO,
+                       unsigned int nbThreads = 1);
 
     /**
      * Voxelize a unique triangle (a,b,c) into the digital set.
@@ -210,10 +294,143 @@ namespace DGtal
                           const VectorR3& n,
                           const std::pair<PointZ3, PointZ3>& bbox);
 
-    // ----------------------- Members ------------------------------
-
+    // ----------------------- Internals ------------------------------
   private:
 
+    /**
+     * Scales a triangle and computes its normal and the bounding box
+     * of its voxels.
+     * @param [in] a the first point of the triangle
+     * @param [in] b the second point of the triangle
+     * @param [in] c the third point of the triangle
+     * @param [in] scaleFactor the scale factor to apply to the triangle
+     * @param [out] A the scaled point a
+     * @param [out] B the scaled point b
+     * @param [out] C the scaled point c
+     * @param [out] n the normal of ABC
+     * @param [out] bbox the bounding box of ABC
+     */
+    template<typename MeshPoint>
+    static
+    void prepareTriangle(const MeshPoint &a, const MeshPoint &b, const MeshPoint &c,
+                         const double scaleFactor,
+                         PointR3& A, PointR3& B, PointR3& C, VectorR3& n,
+                         std::pair<PointZ3, PointZ3>& bbox);
+
+    /**
+     * Calls @a insert on each voxel of @a bbox belonging to the
+     * digitization of ABC.
+     * @param insert a functor called with each voxel (PointZ3).
+     * @param A Point A
+     * @param B Point B
+     * @param C Point C
+     * @param n normal of ABC
+     * @param bbox the box of the traversed voxels
+     */
+    template<typename Inserter>
+    void traverseTriangle(Inserter& insert,
+                          const PointR3& A,
+                          const PointR3& B,
+                          const PointR3& C,
+                          const VectorR3& n,
+                          const std::pair<PointZ3, PointZ3>& bbox) const;
+
+    /**
+     * @param [in] aMesh a mesh.
+     * @param [in] scaleFactor the scale factor to apply to the mesh.
+     * @param [in] aDomain a domain.
+     * @param [out] bbox the bounding box of the voxels of the scaled
+     * mesh, intersected with @a aDomain.
+     * @return 'false' if this box is empty.
+     */
+    template<typename MeshPoint>
+    static
+    bool meshBoundingBox(const Mesh<MeshPoint> &aMesh,
+                         const double scaleFactor,
+                         const Domain &aDomain,
+                         std::pair<PointZ3, PointZ3>& bbox);
+
+    /**
+     * Side of a 2D point @a p with respect to the line (a,b), the
+     * point being symbolically perturbed by (e,e^2) for an infinitely
+     * small e, so that the side is never 0 unless a==b. The value
+     * is exactly opposite for (b,a), hence a point is inside exactly
+     * one of two triangles sharing an edge.
+     * @param a Point a
+     * @param b Point b
+     * @param p point p
+     * @return 1 or -1 according to the side of @a p, 0 if a==b.
+     */
+    static
+    int perturbedSide(const PointR2& a,
+                      const PointR2& b,
+                      const PointR2& p);
+
+    /**
+     * Splits the bounding box of a mesh into slabs along the last
+     * axis, and bins the faces of the mesh into the slabs they span.
+     *
+     * @param [in] aMesh the mesh.
+     * @param [in] scaleFactor the scale factor to apply to the mesh.
+     * @param [in] bbox the box split into slabs.
+     * @param [in] nbThreads the number of threads (0 means as many as
+     * the hardware supports).
+     * @param [out] slabBounds the bounds of the slabs, as offsets along
+     * the last axis from @a bbox.first (one more than the number of slabs).
+     * @param [out] binStart the start of the bin of each slab in @a
+     * bins (one more than the number of slabs).
+     * @param [out] bins the indices of the faces of each slab.
+     */
+    template<typename MeshPoint>
+    static
+    void binFaces(const Mesh<MeshPoint> &aMesh,
+                  const double scaleFactor,
+                  const std::pair<PointZ3, PointZ3>& bbox,
+                  unsigned int nbThreads,
+                  std::vector<std::size_t>& slabBounds,
+                  std::vector<std::size_t>& binStart,
+                  std::vector<DGtal::uint32_t>& bins);
+
+    /**
+     * Voxelize the interior of the mesh into a BIT_PACKED binary
+     * image (see voxelizeSolid).
+     *
+     * @param [in,out] grid the image that collects the voxels.
+     * @param [in] aMesh the mesh to voxelize.
+     * @param [in] scaleFactor the scale factor to apply to the mesh.
+     * @param [in] rule the rule deciding which voxels are inside.
+     * @param [in] nbThreads the number of threads (0 means as many as
+     * the hardware supports).
+     */
+    template<typename MeshPoint>
+    void voxelizeSolidInGrid(BinaryImage &grid,
+                             const Mesh<MeshPoint> &aMesh,
+                             const double scaleFactor,
+                             FillRule rule,
+                             unsigned int nbThreads) const;
+
+    /**
+     * Voxelize the mesh into a BIT_PACKED binary image. The bounding
+     * box of the mesh is split into slabs of rows along the last
+     * axis, faces are binned into the slabs they intersect, and the
+     * slabs are distributed to the threads, each thread writing only
+     * to the rows of its current slab.
+     *
+     * @param [in,out] grid the image that collects the voxels (voxels
+     * outside its domain are skipped).
+     * @param [in] aMesh the mesh to voxelize.
+     * @param [in] scaleFactor the scale factor to apply to the mesh.
+     * @param [in] nbThreads the number of threads (0 means as many as
+     * the hardware supports).
+     */
+    template<typename MeshPoint>
+    void voxelizeInGrid(BinaryImage &grid,
+                        const Mesh<MeshPoint> &aMesh,
+                        const double scaleFactor,
+                        unsigned int nbThreads) const;
+
+    // ----------------------- Members ------------------------------
+
     ///Intersection target
     IntersectionTarget myIntersectionTarget;
   };
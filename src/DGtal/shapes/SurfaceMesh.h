@@ -45,6 +45,7 @@
 #include <string>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/IntegerSequenceIterator.h"
+#include "DGtal/base/ParallelFor.h"
 #include "DGtal/helpers/StdDefs.h"
 
 namespace DGtal
@@ -174,9 +175,14 @@ namespace DGtal
     /// std::vector< Vertices  > faces = { { 0, 1, 2 }, { 0, 2, 3 }, { 0, 3, 4 }, { 0, 4, 1 }, { 4, 3, 2, 1 } };
     /// auto pyramid_mesh = SurfMesh( positions.cbegin(), positions.cend(), faces.cbegin(), faces.cend() );
     /// @endcode
+    ///
+    /// @param nbThreads the number of threads used to compute edges
+    /// and neighborhoods (0 means as many as the hardware supports),
+    /// see init.
     template <typename RealPointIterator, typename VerticesIterator>
     SurfaceMesh( RealPointIterator itPos, RealPointIterator itPosEnd,
-                 VerticesIterator itVertices, VerticesIterator itVerticesEnd );
+                 VerticesIterator itVertices, VerticesIterator itVerticesEnd,
+                 unsigned int nbThreads = 1 );
 
     /// Initializes a mesh from vertex positions and polygonal faces
     /// (clears everything before).
@@ -198,9 +204,16 @@ namespace DGtal
     /// SurfMesh pyramid_mesh;
     /// pyramid_mesh.init( positions.cbegin(), positions.cend(), faces.cbegin(), faces.cend() );
     /// @endcode
+    ///
+    /// @param nbThreads the number of threads used to compute edges
+    /// and neighborhoods (0 means as many as the hardware supports).
+    /// Edges are found by sorting the sides of all faces, and are
+    /// numbered in lexicographic order of their vertex pairs, so the
+    /// mesh does not depend on the number of threads.
     template <typename RealPointIterator, typename VerticesIterator>
     bool init( RealPointIterator itPos, RealPointIterator itPosEnd,
-               VerticesIterator itVertices, VerticesIterator itVerticesEnd );
+               VerticesIterator itVertices, VerticesIterator itVerticesEnd,
+               unsigned int nbThreads = 1 );
 
     /// Clears everything. The object is empty.
     void clear();
@@ -755,10 +768,12 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   protected:
 
-    /// Computes neighboring information.
-    void computeNeighbors();
+    /// Computes neighboring information (edges must be computed).
+    /// @param nbThreads the number of threads (0 means as many as the hardware supports).
+    void computeNeighbors( unsigned int nbThreads = 1 );
     /// Computes edge information.
-    void computeEdges();
+    /// @param nbThreads the number of threads (0 means as many as the hardware supports).
+    void computeEdges( unsigned int nbThreads = 1 );
 
     /// @return a random number between 0.0 and 1.0
     static Scalar rand01()
@@ -0,0 +1,470 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CellHashMap.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module CellHashMap.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CellHashMap_RECURSES)
+#error Recursive header files inclusion detected in CellHashMap.h
+#else // defined(CellHashMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CellHashMap_RECURSES
+
+#if !defined CellHashMap_h
+/** Prevents repeated inclusion of headers. */
+#define CellHashMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <atomic>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ContainerTraits.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CellHashMap
+  /**
+   * Description of template class 'CellHashMap' <p>
+   * \brief Aim: An associative container Cell -> Data, hashed by open
+   * addressing (linear probing) in flat arrays, whose keys are the
+   * Khalimsky coordinates (and sign) of cells packed in one 64 bits
+   * word. It is well suited for caching values on surfels (see
+   * EstimatorCache), where a std::map spends most of its time
+   * chasing pointers and comparing coordinates.
+   *
+   * It is a model of unique pair associative container (like
+   * std::unordered_map). Besides, cells may be inserted by several
+   * threads at once with concurrentInsert, after the capacity has
+   * been reserved: a thread claims a slot by an atomic
+   * compare-and-swap of its packed word, then writes its cell and
+   * data in the slot.
+   *
+   * A word has 62 / dimension bits per coordinate (20 bits in 3D),
+   * one bit for the sign and one bit telling the slot is used. Cells
+   * whose coordinates do not fit (see isPackable, i.e. Khalimsky
+   * coordinates beyond +/- 2^19 in 3D) are still correctly stored by
+   * the serial services, since cells are compared after their words,
+   * but they must not be inserted concurrently.
+   *
+   * References and pointers are proxies with members \a first (a
+   * reference to the cell) and \a second (a reference to the data),
+   * so that \c it->first and \c it->second work as with maps.
+   * Iterators are invalidated by insertions and erasures.
+   *
+   * @code
+   * typedef CellHashMap< KSpace::SCell, RealVector > SurfelMap;
+   * SurfelMap map;
+   * map.reserve( surfels.size() );
+   * functions::parallelFor( surfels.size(), 0,
+   *   [&] ( unsigned int, std::size_t b, std::size_t e )
+   *   { for ( std::size_t i = b; i < e; ++i )
+   *       map.concurrentInsert( std::make_pair( surfels[ i ], normals[ i ] ) ); } );
+   * @endcode
+   *
+   * @tparam TCell the type of cells, either KhalimskyCell or
+   * SignedKhalimskyCell (with integral coordinates).
+   * @tparam TData the type of data associated to each cell (default constructible).
+   *
+   * @see testCellHashMap.cpp
+   */
+  template < typename TCell, typename TData >
+  class CellHashMap
+  {
+  public:
+    typedef CellHashMap< TCell, TData >   Self;
+    typedef TCell                         Cell;
+    typedef TData                         Data;
+    typedef typename Cell::Point          Point;
+    typedef typename Cell::Integer        Integer;
+    typedef DGtal::uint64_t               Word;
+    typedef std::size_t                   Size;
+    static const Dimension dimension = Point::dimension;
+    /// The number of bits of each coordinate in a packed word.
+    static const unsigned int bitsPerCoordinate = 62 / dimension;
+
+    BOOST_STATIC_ASSERT(( bitsPerCoordinate >= 1 ));
+    static_assert( std::is_integral< Integer >::value,
+                   "CellHashMap requires cells with integral coordinates." );
+    static_assert( ! std::is_same< TData, bool >::value,
+                   "CellHashMap cannot store bool data (std::vector<bool> is packed)." );
+
+    // Associative container types
+    typedef Cell                          key_type;
+    typedef Data                          mapped_type;
+    typedef std::pair< const Cell, Data > value_type;
+    typedef Size                          size_type;
+    typedef std::ptrdiff_t                difference_type;
+
+    /**
+     * Proxy on an element of the map, with a reference to the cell as
+     * \a first and a reference to its data as \a second.
+     * @tparam TDataReference either Data& or const Data&.
+     */
+    template < typename TDataReference >
+    struct Reference
+    {
+      const Cell & first;    ///< the cell
+      TDataReference second; ///< its data
+
+      /// Constructor. @param c a cell. @param d its data.
+      Reference( const Cell & c, TDataReference d ) : first( c ), second( d ) {}
+      /// @return a copy of the element, as a pair (cell, data).
+      template < typename TKey, typename TValue >
+      operator std::pair< TKey, TValue >() const
+      { return std::pair< TKey, TValue >( first, second ); }
+      /// @return a pointer to this proxy, so that \c it->second works.
+      const Reference * operator->() const { return this; }
+    };
+
+    typedef Reference< Data & >        reference;
+    typedef Reference< const Data & >  const_reference;
+    typedef reference                  pointer;
+    typedef const_reference            const_pointer;
+
+    /**
+     * Forward iterator on the cells of the map, scanning its slots.
+     * @tparam isConst when 'true', a const_iterator.
+     */
+    template < bool isConst >
+    class Iterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef typename CellHashMap::value_type value_type;
+      typedef typename CellHashMap::difference_type difference_type;
+      typedef typename std::conditional< isConst, typename CellHashMap::const_reference,
+                                         typename CellHashMap::reference >::type reference;
+      typedef reference pointer;
+      typedef typename std::conditional< isConst, const CellHashMap, CellHashMap >::type Container;
+
+      /// Default constructor (singular iterator).
+      Iterator() : myMap( 0 ), mySlot( 0 ) {}
+      /// Constructor. @param map the map. @param slot a used slot of \a map or its capacity.
+      Iterator( Container & map, Size slot ) : myMap( &map ), mySlot( slot ) {}
+      /// Conversion from a mutable iterator. @param other any iterator.
+      template < bool otherIsConst,
+                 typename = typename std::enable_if< isConst || ! otherIsConst >::type >
+      Iterator( const Iterator< otherIsConst > & other )
+        : myMap( other.myMap ), mySlot( other.mySlot ) {}
+
+      /// @return the pointed element.
+      reference operator*() const
+      { return reference( myMap->myCells[ mySlot ], myMap->myData[ mySlot ] ); }
+      /// @return the pointed element, for member access.
+      pointer operator->() const { return **this; }
+      /// Pre-increment. @return a reference to self.
+      Iterator & operator++() { mySlot = myMap->nextSlot( mySlot + 1 ); return *this; }
+      /// Post-increment. @return the previous iterator.
+      Iterator operator++( int ) { Iterator tmp( *this ); ++*this; return tmp; }
+      /// @param other any iterator. @return 'true' iff they point to the same element.
+      bool operator==( const Iterator & other ) const { return mySlot == other.mySlot; }
+      /// @param other any iterator. @return 'true' iff they point to different elements.
+      bool operator!=( const Iterator & other ) const { return mySlot != other.mySlot; }
+      /// @return the slot of the pointed cell.
+      Size slot() const { return mySlot; }
+
+    private:
+      template < bool > friend class Iterator;
+      friend class CellHashMap;
+      /// The map.
+      Container * myMap;
+      /// The slot of the pointed cell, the capacity of the map at the end.
+      Size mySlot;
+    };
+
+    typedef Iterator< false > iterator;
+    typedef Iterator< true >  const_iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor. The map is empty, without any slot.
+    CellHashMap();
+
+    /// Copy constructor. @param other the object to clone.
+    CellHashMap( const CellHashMap & other );
+
+    /**
+     * Constructor from a range of pairs (cell, data).
+     * @param first the beginning of the range.
+     * @param last the end of the range.
+     */
+    template < typename InputIterator >
+    CellHashMap( InputIterator first, InputIterator last );
+
+    /// Assignment. @param other the object to copy. @return a reference on 'this'.
+    CellHashMap & operator=( const CellHashMap & other );
+
+    /// @return 'true' (the map is always valid).
+    bool isValid() const;
+
+    // ----------------------- Container services -----------------------------
+  public:
+
+    /// @return the number of cells of the map.
+    Size size() const;
+    /// @return the maximal number of cells of the map.
+    Size max_size() const;
+    /// @return the number of slots (twice at least the number of cells).
+    Size capacity() const;
+    /// @return 'true' iff the map has no cell.
+    bool empty() const;
+    /// Removes all the cells, keeping the slots.
+    void clear();
+    /// Swaps with another map. @param other any map.
+    void swap( CellHashMap & other );
+
+    /**
+     * Makes room for \a n cells, so that inserting them does not
+     * rehash the map. It must be called before concurrentInsert.
+     * @param n the number of cells the map should be able to hold.
+     */
+    void reserve( Size n );
+
+    /// @return an iterator on the first cell.
+    iterator begin();
+    /// @return an iterator after the last cell.
+    iterator end();
+    /// @return a const iterator on the first cell.
+    const_iterator begin() const;
+    /// @return a const iterator after the last cell.
+    const_iterator end() const;
+
+    /**
+     * @param c any cell.
+     * @return an iterator on \a c if it is in the map, end() otherwise.
+     */
+    iterator find( const Cell & c );
+
+    /**
+     * @param c any cell.
+     * @return an iterator on \a c if it is in the map, end() otherwise.
+     */
+    const_iterator find( const Cell & c ) const;
+
+    /**
+     * @param c any cell.
+     * @return 1 if \a c is in the map, 0 otherwise.
+     */
+    Size count( const Cell & c ) const;
+
+    /**
+     * @param c any cell.
+     * @return the range of the cells equal to \a c.
+     */
+    std::pair< iterator, iterator > equal_range( const Cell & c );
+
+    /**
+     * @param c any cell.
+     * @return the range of the cells equal to \a c.
+     */
+    std::pair< const_iterator, const_iterator > equal_range( const Cell & c ) const;
+
+    /**
+     * Inserts a cell and its data, if the cell is not already in the map.
+     * @param value a pair (cell, data).
+     * @return an iterator on the cell and 'true' if it was inserted.
+     */
+    std::pair< iterator, bool > insert( const value_type & value );
+
+    /**
+     * Inserts a cell and its data, if the cell is not already in the map.
+     * @param hint ignored.
+     * @param value a pair (cell, data).
+     * @return an iterator on the cell.
+     */
+    iterator insert( const_iterator hint, const value_type & value );
+
+    /**
+     * Inserts the cells of a range of pairs (cell, data).
+     * @param first the beginning of the range.
+     * @param last the end of the range.
+     */
+    template < typename InputIterator >
+    void insert( InputIterator first, InputIterator last );
+
+    /**
+     * Inserts a cell and its data, if the cell is not already in the
+     * map, possibly while other threads call concurrentInsert too.
+     * Other services must not be called in the meantime.
+     *
+     * @param value a pair (cell, data).
+     * @return 'true' if the cell was inserted, 'false' if it was already
+     * in the map (its data is then unchanged).
+     *
+     * @pre reserve( n ) has been called, \a n being at least the number
+     * of cells of the map after all insertions.
+     * @pre isPackable( value.first ).
+     */
+    bool concurrentInsert( const value_type & value );
+
+    /**
+     * @param c any cell.
+     * @return a reference to the data of \a c, inserted if needed.
+     */
+    Data & operator[]( const Cell & c );
+
+    /**
+     * @param c any cell.
+     * @return the number of erased cells (0 or 1).
+     */
+    Size erase( const Cell & c );
+
+    /**
+     * @param it an iterator on a cell of the map.
+     */
+    void erase( const_iterator it );
+
+    /**
+     * @param first the beginning of a range of cells of the map.
+     * @param last the end of the range.
+     */
+    void erase( const_iterator first, const_iterator last );
+
+    // ----------------------- Hash services ----------------------------------
+  public:
+
+    /**
+     * @param c any cell.
+     * @return 'true' if the coordinates of \a c fit in a packed word,
+     * so that distinct such cells have distinct words.
+     */
+    static bool isPackable( const Cell & c );
+
+    /**
+     * @param c any cell.
+     * @return the word packing the coordinates and the sign of \a c
+     * (never 0, which marks free slots).
+     */
+    static Word pack( const Cell & c );
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /// @param w a packed word. @return the home slot of \a w.
+    Size homeSlot( Word w ) const;
+
+    /**
+     * @param c any cell.
+     * @param w its packed word.
+     * @return the slot of \a c, or capacity() if it is not in the map.
+     */
+    Size findSlot( const Cell & c, Word w ) const;
+
+    /**
+     * @param slot any slot.
+     * @return the first used slot at or after \a slot, or capacity().
+     */
+    Size nextSlot( Size slot ) const;
+
+    /**
+     * Puts a cell not in the map in its first free slot.
+     * @param value a pair (cell, data).
+     * @param w the packed word of the cell.
+     * @return its slot.
+     * @pre the map has a free slot.
+     */
+    Size place( const value_type & value, Word w );
+
+    /**
+     * Rehashes all the cells in \a n slots.
+     * @param n a power of two, greater than twice the number of cells.
+     */
+    void rehash( Size n );
+
+    /// Removes the cell of slot \a slot, shifting back the following cells.
+    /// @param slot a used slot.
+    void eraseSlot( Size slot );
+
+    /// @param c any cell. @return its sign as a bit (0 for unsigned cells).
+    template < typename TPreCell >
+    static Word signBit( const TPreCell & c );
+
+    /// @param c any signed cell. @return its sign as a bit.
+    template < Dimension dim, typename TInteger >
+    static Word signBit( const SignedKhalimskyPreCell< dim, TInteger > & c );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The number of slots, a power of two (or 0).
+    Size myCapacity;
+    /// The packed word of the cell of each slot, 0 for a free slot.
+    std::unique_ptr< std::atomic< Word >[] > myWords;
+    /// The cell of each slot.
+    std::vector< Cell > myCells;
+    /// The data of each slot.
+    std::vector< Data > myData;
+    /// The number of cells in the map.
+    std::atomic< Size > mySize;
+
+  }; // end of class CellHashMap
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CellHashMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CellHashMap' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TCell, typename TData >
+  std::ostream&
+  operator<< ( std::ostream & out, const CellHashMap< TCell, TData > & object );
+
+  /// Defines container traits for CellHashMap<>.
+  template < typename TCell, typename TData >
+  struct ContainerTraits< CellHashMap< TCell, TData > >
+  {
+    typedef UnorderedMapAssociativeCategory Category;
+  };
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/CellHashMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CellHashMap_h
+
+#undef CellHashMap_RECURSES
+#endif // else defined(CellHashMap_RECURSES)
@@ -79,6 +79,24 @@ namespace DGtal
     uint32_t data;
   };
 
+  namespace detail
+  {
+    /**
+     * Binds the cell containers of a CubicalComplex to its space when
+     * the complex is given one. Associative containers like std::map
+     * do not need the space, hence this does nothing. Specialized by
+     * containers storing cells densely over the space (DenseCellMap).
+     */
+    template < typename TKSpace, typename TCellContainer >
+    struct CubicalCellContainerBinder
+    {
+      /// Does nothing.
+      static void bind( TCellContainer & /* container */,
+                        const TKSpace & /* K */, Dimension /* d */ )
+      {}
+    };
+  } // namespace detail
+
   // Forward definitions.
   template < typename TKSpace, typename TCellContainer >
   class CubicalComplex;
@@ -167,7 +185,8 @@ namespace DGtal
   * it. It could be for instance a std::map or a
   * std::unordered_map. Note that unfortunately, unordered_map are
   * (strangely) not models of boost::AssociativeContainer, hence we
-  * cannot check concepts here.
+  * cannot check concepts here. For complexes covering a large part of
+  * a bounded space, DenseCellMap stores the cells in flat arrays.
   *
   */
   template < typename TKSpace,
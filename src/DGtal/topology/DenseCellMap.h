@@ -0,0 +1,462 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DenseCellMap.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module DenseCellMap.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DenseCellMap_RECURSES)
+#error Recursive header files inclusion detected in DenseCellMap.h
+#else // defined(DenseCellMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DenseCellMap_RECURSES
+
+#if !defined DenseCellMap_h
+/** Prevents repeated inclusion of headers. */
+#define DenseCellMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ContainerTraits.h"
+#include "DGtal/topology/CubicalComplex.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DenseCellMap
+  /**
+   * Description of template class 'DenseCellMap' <p>
+   * \brief Aim: An associative container Cell -> Data that stores
+   * the cells of a bounded cellular grid space densely: the data of
+   * each possible cell is an element of a linear array, and the
+   * presence of each cell is a bit of an array of 64 bits words.
+   *
+   * It is a model of unique pair associative container (like
+   * std::unordered_map) and may be given as cell container of
+   * CubicalComplex or VoxelComplex, instead of a std::map. Finding,
+   * inserting or erasing a cell is then a computation of index
+   * instead of a chain of lookups, and the cells are visited by
+   * scanning words of bits, i.e. in the order of their indices.
+   *
+   * A map is bound to a space and to the dimension of its cells (see
+   * init), since a CubicalComplex stores its cells of dimension \a d
+   * in its \a d-th container. The index of a cell is the rank of its
+   * lower spel in the bounding box of the space (x first) times the
+   * number of cell types of this dimension, plus the rank of its
+   * type. Hence the containers of a complex use together one Data
+   * and one bit per cell of the whole Khalimsky space, whatever the
+   * number of cells in the complex. It is thus well suited for
+   * complexes covering a large part of their space (like those built
+   * by VoxelComplex from an image).
+   *
+   * References and pointers are proxies with members \a first (a
+   * reference to the cell, which is held by the iterator) and \a
+   * second (a reference to the data), so that \c it->first and \c
+   * it->second work as with maps. Iterators stay valid when other
+   * cells are inserted or erased.
+   *
+   * @code
+   * typedef DenseCellMap< KSpace, CubicalCellData > CellContainer;
+   * typedef CubicalComplex< KSpace, CellContainer > CC;
+   * CC complex( K ); // containers are bound to K.
+   * @endcode
+   *
+   * @tparam TKSpace any model of concepts::CCellularGridSpaceND.
+   * @tparam TData the type of data associated to each cell (default constructible).
+   *
+   * @see testDenseCellMap.cpp
+   */
+  template < typename TKSpace, typename TData >
+  class DenseCellMap
+  {
+  public:
+    typedef DenseCellMap< TKSpace, TData > Self;
+    typedef TKSpace                        KSpace;
+    typedef TData                          Data;
+    typedef typename KSpace::Cell          Cell;
+    typedef typename KSpace::Point         Point;
+    typedef typename KSpace::Integer       Integer;
+    typedef DGtal::uint64_t                Word;
+    typedef std::size_t                    Size;
+    static const Dimension dimension = KSpace::dimension;
+
+    // Associative container types
+    typedef Cell                       key_type;
+    typedef Data                       mapped_type;
+    typedef std::pair< const Cell, Data > value_type;
+    typedef Size                       size_type;
+    typedef std::ptrdiff_t             difference_type;
+
+    /**
+     * Proxy on an element of the map, with a reference to the cell as
+     * \a first and a reference to its data as \a second. The cell is
+     * held by the dereferenced iterator.
+     * @tparam TDataReference either Data& or const Data&.
+     */
+    template < typename TDataReference >
+    struct Reference
+    {
+      const Cell & first;    ///< the cell
+      TDataReference second; ///< its data
+
+      /// Constructor. @param c a cell. @param d its data.
+      Reference( const Cell & c, TDataReference d ) : first( c ), second( d ) {}
+      /// @return a copy of the element, as a pair (cell, data).
+      template < typename TKey, typename TValue >
+      operator std::pair< TKey, TValue >() const
+      { return std::pair< TKey, TValue >( first, second ); }
+      /// @return a pointer to this proxy, so that \c it->second works.
+      const Reference * operator->() const { return this; }
+    };
+
+    typedef Reference< Data & >        reference;
+    typedef Reference< const Data & >  const_reference;
+    typedef reference                  pointer;
+    typedef const_reference            const_pointer;
+
+    /**
+     * Forward iterator on the cells of the map, scanning its words of
+     * bits.
+     * @tparam isConst when 'true', a const_iterator.
+     */
+    template < bool isConst >
+    class Iterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef typename DenseCellMap::value_type value_type;
+      typedef typename DenseCellMap::difference_type difference_type;
+      typedef typename std::conditional< isConst, typename DenseCellMap::const_reference,
+                                         typename DenseCellMap::reference >::type reference;
+      typedef reference pointer;
+      typedef typename std::conditional< isConst, const DenseCellMap, DenseCellMap >::type Container;
+
+      /// Default constructor (singular iterator).
+      Iterator() : myMap( 0 ), myIndex( 0 ) {}
+      /// Constructor. @param map the map. @param index the index of a cell of \a map or its capacity.
+      Iterator( Container & map, Size index ) : myMap( &map ), myIndex( index ) {}
+      /// Conversion from a mutable iterator. @param other any iterator.
+      template < bool otherIsConst,
+                 typename = typename std::enable_if< isConst || ! otherIsConst >::type >
+      Iterator( const Iterator< otherIsConst > & other )
+        : myMap( other.myMap ), myIndex( other.myIndex ) {}
+
+      /// @return the pointed element, valid while this iterator is not moved.
+      reference operator*() const
+      {
+        myCell = myMap->cellAt( myIndex );
+        return reference( myCell, myMap->myData[ myIndex ] );
+      }
+      /// @return the pointed element, for member access.
+      pointer operator->() const { return **this; }
+      /// Pre-increment. @return a reference to self.
+      Iterator & operator++() { myIndex = myMap->nextIndex( myIndex + 1 ); return *this; }
+      /// Post-increment. @return the previous iterator.
+      Iterator operator++( int ) { Iterator tmp( *this ); ++*this; return tmp; }
+      /// @param other any iterator. @return 'true' iff they point to the same element.
+      bool operator==( const Iterator & other ) const { return myIndex == other.myIndex; }
+      /// @param other any iterator. @return 'true' iff they point to different elements.
+      bool operator!=( const Iterator & other ) const { return myIndex != other.myIndex; }
+      /// @return the index of the pointed cell.
+      Size index() const { return myIndex; }
+
+    private:
+      template < bool > friend class Iterator;
+      friend class DenseCellMap;
+      /// The map.
+      Container * myMap;
+      /// The index of the pointed cell, the capacity of the map at the end.
+      Size myIndex;
+      /// The pointed cell, computed when dereferencing.
+      mutable Cell myCell;
+    };
+
+    typedef Iterator< false > iterator;
+    typedef Iterator< true >  const_iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor. The map is not bound to a space and cannot
+     * hold any cell.
+     */
+    DenseCellMap();
+
+    /**
+     * Constructor of an empty map for the cells of \a aK of dimension
+     * \a d, or for all its cells when \a d > dimension.
+     * @param aK any space, referenced by the map.
+     * @param d the dimension of the cells of the map.
+     */
+    DenseCellMap( ConstAlias< KSpace > aK, Dimension d = dimension + 1 );
+
+    /**
+     * Binds the map to a space and clears it.
+     * @param aK any space, referenced by the map.
+     * @param d the dimension of the cells of the map, all cells when \a d > dimension.
+     */
+    void init( ConstAlias< KSpace > aK, Dimension d = dimension + 1 );
+
+    /// @return 'true' if the map is bound to a space.
+    bool isValid() const;
+
+    // ----------------------- Container services -----------------------------
+  public:
+
+    /// @return the number of cells of the map.
+    Size size() const;
+    /// @return the maximal number of cells of the map.
+    Size max_size() const;
+    /// @return the number of cells that may be stored in the map.
+    Size capacity() const;
+    /// @return 'true' iff the map has no cell.
+    bool empty() const;
+    /// Removes all the cells (the data are reset to Data()).
+    void clear();
+    /// Swaps with another map. @param other any map.
+    void swap( DenseCellMap & other );
+
+    /// @return an iterator on the first cell.
+    iterator begin();
+    /// @return an iterator after the last cell.
+    iterator end();
+    /// @return a const iterator on the first cell.
+    const_iterator begin() const;
+    /// @return a const iterator after the last cell.
+    const_iterator end() const;
+
+    /**
+     * @param c any cell.
+     * @return an iterator on \a c if it is in the map, end() otherwise.
+     */
+    iterator find( const Cell & c );
+
+    /**
+     * @param c any cell.
+     * @return an iterator on \a c if it is in the map, end() otherwise.
+     */
+    const_iterator find( const Cell & c ) const;
+
+    /**
+     * @param c any cell.
+     * @return 1 if \a c is in the map, 0 otherwise.
+     */
+    Size count( const Cell & c ) const;
+
+    /**
+     * @param c any cell.
+     * @return the range of the cells equal to \a c.
+     */
+    std::pair< iterator, iterator > equal_range( const Cell & c );
+
+    /**
+     * @param c any cell.
+     * @return the range of the cells equal to \a c.
+     */
+    std::pair< const_iterator, const_iterator > equal_range( const Cell & c ) const;
+
+    /**
+     * Inserts a cell and its data, if the cell is not already in the map.
+     * @param value a pair (cell, data).
+     * @return an iterator on the cell and 'true' if it was inserted,
+     * (end(), false) if the cell cannot be stored in this map.
+     */
+    std::pair< iterator, bool > insert( const value_type & value );
+
+    /**
+     * Inserts a cell and its data, if the cell is not already in the map.
+     * @param hint ignored.
+     * @param value a pair (cell, data).
+     * @return an iterator on the cell.
+     */
+    iterator insert( const_iterator hint, const value_type & value );
+
+    /**
+     * Inserts the cells of a range of pairs (cell, data).
+     * @param first the beginning of the range.
+     * @param last the end of the range.
+     */
+    template < typename InputIterator >
+    void insert( InputIterator first, InputIterator last );
+
+    /**
+     * @param c a cell that can be stored in the map.
+     * @return a reference to the data of \a c, inserted if needed.
+     */
+    Data & operator[]( const Cell & c );
+
+    /**
+     * @param c any cell.
+     * @return the number of erased cells (0 or 1).
+     */
+    Size erase( const Cell & c );
+
+    /**
+     * @param it an iterator on a cell of the map.
+     */
+    void erase( const_iterator it );
+
+    /**
+     * @param first the beginning of a range of cells of the map.
+     * @param last the end of the range.
+     */
+    void erase( const_iterator first, const_iterator last );
+
+    // ----------------------- Dense services ---------------------------------
+  public:
+
+    /**
+     * @param c any cell.
+     * @return 'true' if \a c can be stored in this map.
+     */
+    bool isStorable( const Cell & c ) const;
+
+    /**
+     * @param c a cell that can be stored in the map.
+     * @return its index in the arrays of the map.
+     */
+    Size index( const Cell & c ) const;
+
+    /**
+     * @param idx an index smaller than capacity().
+     * @return the corresponding cell.
+     */
+    Cell cellAt( Size idx ) const;
+
+    /// @return the data of all the storable cells (indexed like cells).
+    const std::vector< Data > & dataArray() const;
+
+    /// @return the words of bits of presence of the cells, bit \a i
+    /// of word \a w being the cell of index 64w+i.
+    const std::vector< Word > & words() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * @param c any cell.
+     * @param[out] idx its index, when it is storable.
+     * @return 'true' if \a c can be stored in this map.
+     */
+    bool computeIndex( const Cell & c, Size & idx ) const;
+
+    /**
+     * @param idx any index.
+     * @return the index of the first cell of the map at or after \a idx,
+     * or capacity().
+     */
+    Size nextIndex( Size idx ) const;
+
+    /// @param idx an index. @return 'true' if the cell of index \a idx is in the map.
+    bool hasIndex( Size idx ) const;
+
+    /// @param k any integer. @return the floor of \a k / 2.
+    static Integer floorHalf( Integer k );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The space of the cells.
+    const KSpace * mySpace;
+    /// The dimension of the cells, greater than dimension for all cells.
+    Dimension myCellDimension;
+    /// Half of the Khalimsky coordinates of the lowest storable cell.
+    Point myLowerHalf;
+    /// Number of spels (plus one) along each axis.
+    std::vector< Size > myExtent;
+    /// For each parity of Khalimsky coordinates, the rank of the type
+    /// of cell in the map, or -1 when these cells are not stored.
+    std::vector< int > myRanks;
+    /// The parities of the Khalimsky coordinates of each stored type of cell.
+    std::vector< unsigned int > myParities;
+    /// The data of each storable cell.
+    std::vector< Data > myData;
+    /// The presence of each storable cell.
+    std::vector< Word > myWords;
+    /// The number of cells in the map.
+    Size mySize;
+
+  }; // end of class DenseCellMap
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DenseCellMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DenseCellMap' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TKSpace, typename TData >
+  std::ostream&
+  operator<< ( std::ostream & out, const DenseCellMap< TKSpace, TData > & object );
+
+  /// Defines container traits for DenseCellMap<>.
+  template < typename TKSpace, typename TData >
+  struct ContainerTraits< DenseCellMap< TKSpace, TData > >
+  {
+    typedef UnorderedMapAssociativeCategory Category;
+  };
+
+  namespace detail
+  {
+    /// Binds the \a d-th cell container of a CubicalComplex to its space.
+    template < typename TKSpace, typename TData >
+    struct CubicalCellContainerBinder< TKSpace, DenseCellMap< TKSpace, TData > >
+    {
+      /// @param container a cell container. @param K the space. @param d the dimension of its cells.
+      static void bind( DenseCellMap< TKSpace, TData > & container,
+                        const TKSpace & K, Dimension d )
+      {
+        container.init( K, d );
+      }
+    };
+  } // namespace detail
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/DenseCellMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DenseCellMap_h
+
+#undef DenseCellMap_RECURSES
+#endif // else defined(DenseCellMap_RECURSES)
@@ -41,7 +41,9 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <algorithm>
 #include <array>
+#include <vector>
 #include "DGtal/base/Common.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -120,6 +122,9 @@ namespace DGtal
     // A map from an arc (a std::pair of VertexIndex's) to its face
     // index.
     typedef std::map< Arc, FaceIndex > Arc2FaceIndex;
+    // A vector of arcs (std::pair of VertexIndex's) with their face
+    // index, sorted by arc then face index.
+    typedef std::vector< std::pair< Arc, FaceIndex > > Arc2FaceIndexRange;
     
     /// Represents an unoriented edge as two vertex indices, the first
     /// lower than the second.
@@ -1426,6 +1431,21 @@ namespace DGtal
         }
       return it->second;
     }
+
+    static
+    FaceIndex arc2FaceIndex( const Arc2FaceIndexRange& de2fi,
+                             VertexIndex vi, VertexIndex vj )
+    {
+      ASSERT( !de2fi.empty() );
+
+      auto it = std::lower_bound( de2fi.cbegin(), de2fi.cend(),
+                                  std::make_pair( Arc( vi, vj ), FaceIndex( 0 ) ) );
+      // If no such directed edge exists, then there's no such face in the mesh.
+      // The edge must be a boundary edge.
+      if( it == de2fi.cend() || it->first != Arc( vi, vj ) )
+        return HALF_EDGE_INVALID_INDEX;
+      return it->second;
+    }
         
   }; // end of class HalfEdgeDataStructure
 
@@ -48,6 +48,8 @@
 #include "DGtal/base/OwningOrAliasingPtr.h"
 #include "DGtal/base/IntegerSequenceIterator.h"
 #include "DGtal/topology/HalfEdgeDataStructure.h"
+#include "DGtal/topology/LinearizedCellIndex.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
 #include "DGtal/topology/CDigitalSurfaceContainer.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -116,6 +118,9 @@ namespace DGtal
     typedef std::vector<RealPoint>                   PositionsStorage;
     typedef std::vector<PolygonalFace>               PolygonalFacesStorage;
     typedef std::vector<SCell>                       SCellStorage;
+    /// Mapping from cells (surfels, linels or pointels) to indices,
+    /// found at their linearized Khalimsky coordinates.
+    typedef LinearizedCellIndex<KSpace>              CellIndex;
 
     // Required by CUndirectedSimpleLocalGraph
     typedef VertexIndex                              Vertex;
@@ -270,6 +275,12 @@ namespace DGtal
     /// @return true if everything went allright, false if it was not
     /// possible to build a consistent data structure (e.g., butterfly
     /// neighborhoods).
+    ///
+    /// @note Each face is computed by a single walk around its
+    /// pivot, and surfels, linels and pointels are indexed by their
+    /// Khalimsky coordinates in a LinearizedCellIndex over the
+    /// bounding box of the surface, so that methods getVertex, getArc
+    /// and getFace take a constant time.
     bool build( ConstAlias< DigitalSurfaceContainer > surfContainer );
 
     /**
@@ -417,8 +428,9 @@ namespace DGtal
     /// or INVALID_FACE if it does not exist.
     Vertex getVertex( const SCell& aSurfel ) const
     {
-      auto it = mySurfel2VertexIndex.find( aSurfel );
-      return it != mySurfel2VertexIndex.end() ? it->second : INVALID_FACE;
+      const Index v = myCellIndex.get( aSurfel );
+      return ( v < myVertexIndex2Surfel.size() && myVertexIndex2Surfel[ v ] == aSurfel )
+        ? v : INVALID_FACE;
     }
 
     /// @param[in] aLinel any linel that is a separator on the surface (orientation is important).
@@ -427,8 +439,12 @@ namespace DGtal
     /// or INVALID_FACE if it does not exist.
     Arc getArc( const SCell& aLinel ) const
     {
-      auto it = myLinel2Arc.find( aLinel );
-      return it != myLinel2Arc.end() ? it->second : INVALID_FACE;
+      const Index a = myCellIndex.get( aLinel );
+      if ( a >= myArc2Linel.size() ) return INVALID_FACE;
+      if ( myArc2Linel[ a ] == aLinel ) return a;
+      // An arc and its opposite share the entry of their linel.
+      const Arc b = myHEDS.halfEdge( a ).opposite;
+      return myArc2Linel[ b ] == aLinel ? b : INVALID_FACE;
     }
 
     /// @param[in] aPointel any pointel that is a pivot on the surface (orientation is positive).
@@ -437,8 +453,9 @@ namespace DGtal
     /// or INVALID_FACE if it does not exist.
     Face getFace( const SCell& aPointel ) const
     {
-      auto it = myPointel2FaceIndex.find( aPointel );
-      return it != myPointel2FaceIndex.end() ? it->second : INVALID_FACE;
+      const Index f = myCellIndex.get( aPointel );
+      return ( f < myFaceIndex2Pointel.size() && myFaceIndex2Pointel[ f ] == aPointel )
+        ? f : INVALID_FACE;
     }
     
     // ----------------------- Undirected simple graph services -------------------------
@@ -676,12 +693,11 @@ namespace DGtal
     PositionsStorage      myPositions;
     /// Stores the polygonal faces.
     PolygonalFacesStorage myPolygonalFaces;
-    /// Mapping Surfel ->  VertexIndex
-    std::map< SCell, VertexIndex > mySurfel2VertexIndex;
-    /// Mapping Linel  -> Arc
-    std::map< SCell, Arc >         myLinel2Arc;
-    /// Mapping Pointel -> FaceIndex
-    std::map< SCell, FaceIndex >   myPointel2FaceIndex;
+    /// Mapping Surfel -> VertexIndex, Linel -> Arc and Pointel ->
+    /// FaceIndex (the cells of each kind have their own Khalimsky
+    /// coordinates, and lookups check the cell found at the index,
+    /// or at the opposite arc for linels).
+    CellIndex             myCellIndex;
     /// Mapping VertexIndex -> Surfel
     SCellStorage          myVertexIndex2Surfel;
     /// Mapping Arc         -> Linel
@@ -70,6 +70,12 @@ namespace DGtal
   template < class TKhalimskySpace >
   class KhalimskySpaceNDHelper;
 
+  /// Pre-declaration of the packed cells of PackedKhalimskySpaceND.
+  template < Dimension dim, typename TInteger, typename TWord >
+  struct PackedKhalimskyCell;
+  template < Dimension dim, typename TInteger, typename TWord >
+  struct PackedSignedKhalimskyCell;
+
   /////////////////////////////////////////////////////////////////////////////
   /**
    * @brief Represents an (unsigned) cell in a cellular grid space by its
@@ -99,6 +105,7 @@ namespace DGtal
     // Friendship
     friend class KhalimskySpaceND< dim, TInteger >;
     friend class KhalimskySpaceNDHelper< CellularGridSpace >;
+    template < Dimension, typename, typename > friend struct PackedKhalimskyCell;
 
   private:
     /// Underlying pre-cell
@@ -223,6 +230,7 @@ namespace DGtal
     // Friendship
     friend class KhalimskySpaceND< dim, TInteger >;
     friend class KhalimskySpaceNDHelper< CellularGridSpace >;
+    template < Dimension, typename, typename > friend struct PackedSignedKhalimskyCell;
 
   private:
     /// Underlying signed pre-cell
@@ -0,0 +1,262 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file LinearizedCellIndex.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module LinearizedCellIndex.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(LinearizedCellIndex_RECURSES)
+#error Recursive header files inclusion detected in LinearizedCellIndex.h
+#else // defined(LinearizedCellIndex_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define LinearizedCellIndex_RECURSES
+
+#if !defined LinearizedCellIndex_h
+/** Prevents repeated inclusion of headers. */
+#define LinearizedCellIndex_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/NumberTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class LinearizedCellIndex
+  /**
+   * Description of template class 'LinearizedCellIndex' <p>
+   * \brief Aim: Associates a 32-bit index to cells of any dimension
+   * lying in a box of Khalimsky coordinates, where a cell is found
+   * at its linearized Khalimsky coordinates, without hashing nor
+   * probing.
+   *
+   * The box is cut into pages of \f$ 4^n \f$ Khalimsky coordinates,
+   * stored one after the other in a flat vector. A directory, also
+   * flat, gives for each page of the box its position in this vector,
+   * and pages are only allocated when a cell is set in them. Looking
+   * up a cell thus reads two arrays, and the memory is proportional
+   * to the number of pages crossed by the cells, which is small for
+   * cells around a surface, and to the volume of the box divided by
+   * \f$ 4^n \f$ for the directory.
+   *
+   * Cells of distinct dimensions or distinct orientations have
+   * distinct Khalimsky coordinates, hence distinct entries, except
+   * the two signed cells with the same coordinates, which share their
+   * entry.
+   *
+   * It is used by IndexedDigitalSurface to find its vertices, arcs
+   * and faces from their surfels, linels and pointels.
+   *
+   * @tparam TKSpace the type of cellular grid space, a model of
+   * concepts::CCellularGridSpaceND.
+   *
+   * @see testLinearizedCellIndex.cpp
+   */
+  template < typename TKSpace >
+  class LinearizedCellIndex
+  {
+  public:
+    typedef LinearizedCellIndex< TKSpace > Self;
+    typedef TKSpace                        KSpace;
+    typedef typename KSpace::Cell          Cell;
+    typedef typename KSpace::SCell         SCell;
+    typedef typename KSpace::Point         Point;
+    typedef typename KSpace::Integer       Integer;
+    typedef std::size_t                    Size;
+    /// The type of the stored indices.
+    typedef DGtal::uint32_t                Index;
+    static const Dimension dimension = KSpace::dimension;
+
+    /// The index of cells that were not set.
+    static const Index INVALID_INDEX = std::numeric_limits< Index >::max();
+    /// The number of bits of a page coordinate (pages are 4 wide).
+    static const unsigned int PAGE_BITS = 2;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor. The object is not valid, see init.
+     */
+    LinearizedCellIndex();
+
+    /**
+     * Constructor.
+     *
+     * @param aK the cellular grid space, referenced by the object.
+     * @param lowerK the lowest Khalimsky coordinates of the box.
+     * @param upperK the uppermost Khalimsky coordinates of the box.
+     */
+    LinearizedCellIndex( ConstAlias< KSpace > aK,
+                         const Point & lowerK, const Point & upperK );
+
+    /**
+     * (Re)initializes the object. Every cell of the box has then no
+     * index.
+     *
+     * @param aK the cellular grid space, referenced by the object.
+     * @param lowerK the lowest Khalimsky coordinates of the box.
+     * @param upperK the uppermost Khalimsky coordinates of the box.
+     */
+    void init( ConstAlias< KSpace > aK,
+               const Point & lowerK, const Point & upperK );
+
+    /// Removes every index and the box. The object is not valid.
+    void clear();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @param c any cell.
+     * @return the index of \a c, or INVALID_INDEX if it was not set
+     * (e.g. \a c is not in the box, or the object is not valid).
+     */
+    Index get( const Cell & c ) const;
+
+    /**
+     * @param c any signed cell.
+     * @return the index of \a c, or INVALID_INDEX if it was not set
+     * (e.g. \a c is not in the box, or the object is not valid).
+     */
+    Index get( const SCell & c ) const;
+
+    /**
+     * Sets the index of a cell, allocating its page if necessary.
+     *
+     * @pre \a c lies in the box.
+     * @param c any cell.
+     * @param i any index but INVALID_INDEX.
+     */
+    void set( const Cell & c, Index i );
+
+    /**
+     * Sets the index of a signed cell, allocating its page if necessary.
+     *
+     * @pre \a c lies in the box.
+     * @param c any signed cell.
+     * @param i any index but INVALID_INDEX.
+     */
+    void set( const SCell & c, Index i );
+
+    /**
+     * @param kp any Khalimsky coordinates.
+     * @return 'true' iff \a kp lies in the box.
+     */
+    bool isInside( const Point & kp ) const;
+
+    /// @return the number of allocated pages.
+    Size nbPages() const;
+
+    /// @return the number of bytes used by the object.
+    Size memoryUsage() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The number of entries of a page.
+    static const Size PAGE_SIZE = Size( 1 ) << ( PAGE_BITS * dimension );
+
+    /// The referenced space.
+    const KSpace * mySpace;
+    /// The lowest Khalimsky coordinates of the box.
+    Point myLowerK;
+    /// The number of Khalimsky coordinates of the box along each axis.
+    std::vector< Size > myExtent;
+    /// The number of pages of the box along each axis.
+    std::vector< Size > myPageExtent;
+    /// The position in myIndices of each page divided by PAGE_SIZE,
+    /// plus one, or 0 if the page is not allocated.
+    std::vector< Index > myDirectory;
+    /// The indices of the allocated pages, one page after the other.
+    std::vector< Index > myIndices;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * @param kp any Khalimsky coordinates.
+     * @param[out] page the index of the page of \a kp in the directory.
+     * @param[out] offset the offset of \a kp in its page.
+     * @return 'true' iff \a kp lies in the box.
+     */
+    bool locate( const Point & kp, Size & page, Size & offset ) const;
+
+    /**
+     * @param kp any Khalimsky coordinates.
+     * @return the index stored at \a kp.
+     */
+    Index getAt( const Point & kp ) const;
+
+    /**
+     * @param kp any Khalimsky coordinates in the box.
+     * @param i the index to store at \a kp.
+     */
+    void setAt( const Point & kp, Index i );
+
+  }; // end of class LinearizedCellIndex
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'LinearizedCellIndex'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'LinearizedCellIndex' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TKSpace >
+  std::ostream&
+  operator<< ( std::ostream & out, const LinearizedCellIndex< TKSpace > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/LinearizedCellIndex.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined LinearizedCellIndex_h
+
+#undef LinearizedCellIndex_RECURSES
+#endif // else defined(LinearizedCellIndex_RECURSES)
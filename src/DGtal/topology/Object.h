@@ -60,6 +60,7 @@
 #include <boost/graph/properties.hpp>
 #include <boost/dynamic_bitset.hpp>
 #include <unordered_map>
+#include <vector>
 #include <DGtal/topology/helpers/NeighborhoodConfigurationsHelper.h>
 //////////////////////////////////////////////////////////////////////////////
 
@@ -295,6 +296,57 @@ namespace DGtal
 	const Point & center,
 	const std::unordered_map< Point,
 	NeighborhoodConfiguration> & mapZeroNeighborhoodToMask) const;
+
+    /**
+     * Builds a dense image storing, for each point of the domain, the
+     * occupancy configuration of its neighborhood (see
+     * getNeighborhoodConfigurationOccupancy). The masks are then
+     * updated incrementally by insert and erase, and isSimple (with a
+     * table set with setTable) becomes a single table lookup.
+     *
+     * @note While the masks are enabled, the points of the object must
+     * be inserted and erased with insert and erase, not through
+     * pointSet(), otherwise the masks are outdated.
+     *
+     * @note Only for dimensions up to 3 (the masks have 32 bits), and
+     * the memory is proportional to the bounding box of the domain.
+     */
+    void enableOccupancyMasks();
+
+    /**
+     * Frees the occupancy masks, see enableOccupancyMasks.
+     */
+    void disableOccupancyMasks();
+
+    /**
+     * @return 'true' if the occupancy masks are maintained, see
+     * enableOccupancyMasks.
+     */
+    bool hasOccupancyMasks() const;
+
+    /**
+     * @param center any point of the domain.
+     * @return the occupancy configuration of the neighborhood of \a
+     * center, read in the occupancy masks if they are enabled,
+     * computed with getNeighborhoodConfigurationOccupancy otherwise.
+     */
+    NeighborhoodConfiguration neighborhoodConfiguration( const Point & center ) const;
+
+    /**
+     * Inserts a point in the object, updating the occupancy masks of
+     * its neighbors if they are enabled.
+     * @param p any point of the domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Erases a point from the object, updating the occupancy masks of
+     * its neighbors if they are enabled.
+     * @param p any point.
+     * @return the number of erased points (0 or 1).
+     */
+    Size erase( const Point & p );
+
     /**
      * @return the number of elements in the set.
      */
@@ -674,6 +726,29 @@ objects[ 0 ].writeComponents( it ); // it points in same container as this.
      */
     bool myTableIsLoaded;
 
+    /**
+     * Occupancy configuration of the neighborhood of each point of the
+     * domain bounding box (x first), or null if not maintained.
+     * @see enableOccupancyMasks
+     */
+    CowPtr< std::vector< NeighborhoodConfiguration > > myOccupancyMasks;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * @param p any point of the domain.
+     * @return the index of \a p in myOccupancyMasks.
+     */
+    Size occupancyIndex( const Point & p ) const;
+
+    /**
+     * Updates the occupancy masks of the neighbors of a point.
+     * @param p the inserted or erased point.
+     * @param inserted 'true' if \a p is inserted, 'false' if erased.
+     */
+    void updateOccupancyMasks( const Point & p, bool inserted );
+
     // --------------- CDrawableWithBoard2D realization ------------------
   public:
     /**
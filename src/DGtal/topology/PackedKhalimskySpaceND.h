@@ -0,0 +1,762 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedKhalimskySpaceND.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module PackedKhalimskySpaceND.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedKhalimskySpaceND_RECURSES)
+#error Recursive header files inclusion detected in PackedKhalimskySpaceND.h
+#else // defined(PackedKhalimskySpaceND_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedKhalimskySpaceND_RECURSES
+
+#if !defined PackedKhalimskySpaceND_h
+/** Prevents repeated inclusion of headers. */
+#define PackedKhalimskySpaceND_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <boost/functional/hash.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  /**
+   * @brief Represents an (unsigned) cell of a PackedKhalimskySpaceND:
+   * its Khalimsky coordinates are packed into a single unsigned
+   * integer of type \a TWord, each coordinate taking
+   * bitsPerCoordinate bits. The order of the words is the
+   * lexicographic order of KhalimskyCell.
+   *
+   * The cell is implicitly built from a KhalimskyCell and converts
+   * implicitly to a KhalimskyPreCell.
+   *
+   * @tparam dim the dimension of the digital space.
+   * @tparam TInteger the Integer class of the coordinates.
+   * @tparam TWord an unsigned integer type (e.g. DGtal::uint64_t).
+   */
+  template < Dimension dim,
+             typename TInteger = DGtal::int32_t,
+             typename TWord = DGtal::uint64_t >
+  struct PackedKhalimskyCell
+  {
+    BOOST_STATIC_ASSERT_MSG( std::is_unsigned< TWord >::value, "TWord must be an unsigned integer." );
+
+    // Aliases
+  public:
+    using Integer = TInteger;
+    using Word    = TWord;
+    using Point   = PointVector< dim, Integer >;
+    using Cell    = KhalimskyCell< dim, Integer >;
+    using PreCell = KhalimskyPreCell< dim, Integer >;
+    using Self    = PackedKhalimskyCell< dim, Integer, Word >;
+
+    /// Number of bits of each Khalimsky coordinate (the most
+    /// significant bit of the word is left for the sign of signed cells).
+    static const constexpr unsigned int bitsPerCoordinate =
+      ( 8 * sizeof( Word ) - 1 ) / dim;
+
+    BOOST_STATIC_ASSERT_MSG( bitsPerCoordinate >= 2, "TWord is too small for this dimension." );
+
+    /// @return the smallest representable Khalimsky coordinate.
+    static Integer minCoordinate();
+
+    /// @return the greatest representable Khalimsky coordinate.
+    static Integer maxCoordinate();
+
+    /**
+     * @param kp any Khalimsky coordinates.
+     * @return 'true' if each coordinate of \a kp is representable.
+     */
+    static bool isRepresentable( const Point & kp );
+
+    /**
+     * @param kp representable Khalimsky coordinates.
+     * @return the packed coordinates.
+     */
+    static Word pack( const Point & kp );
+
+    /**
+     * @param aWord packed coordinates.
+     * @return the Khalimsky coordinates.
+     */
+    static Point unpack( Word aWord );
+
+  public:
+    /** @brief
+     * Default constructor (cell of null coordinates).
+     */
+    explicit PackedKhalimskyCell( Integer dummy = 0 );
+
+    /** @brief Implicit constructor from a cell.
+     * @param aCell any cell with representable coordinates.
+     */
+    PackedKhalimskyCell( const Cell & aCell );
+
+    /// @return the corresponding KhalimskyCell.
+    Cell cell() const;
+
+    /// Implicit conversion to KhalimskyPreCell.
+    operator PreCell() const;
+
+    /// @return the underlying pre-cell.
+    PreCell preCell() const;
+
+    /// @return the packed coordinates.
+    Word word() const;
+
+    /** @brief Equality operator.
+     * @param other any other cell.
+     */
+    bool operator==( const PackedKhalimskyCell & other ) const;
+
+    /** @brief Difference operator.
+     * @param other any other cell.
+     */
+    bool operator!=( const PackedKhalimskyCell & other ) const;
+
+    /** @brief Inferior operator (lexicographic order).
+     * @param other any other cell.
+     */
+    bool operator<( const PackedKhalimskyCell & other ) const;
+
+    /** @brief Return the style name used for drawing this object.
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+  private:
+    /// Packed Khalimsky coordinates.
+    Word myWord;
+  };
+
+  template < Dimension dim, typename TInteger, typename TWord >
+  std::ostream &
+  operator<<( std::ostream & out,
+              const PackedKhalimskyCell< dim, TInteger, TWord > & object );
+
+  /////////////////////////////////////////////////////////////////////////////
+  /**
+   * @brief Represents a signed cell of a PackedKhalimskySpaceND: its
+   * Khalimsky coordinates are packed like PackedKhalimskyCell and its
+   * sign is the most significant bit of the word. The order of the
+   * words is the order of SignedKhalimskyCell.
+   *
+   * The cell is implicitly built from a SignedKhalimskyCell and
+   * converts implicitly to a SignedKhalimskyPreCell.
+   *
+   * @tparam dim the dimension of the digital space.
+   * @tparam TInteger the Integer class of the coordinates.
+   * @tparam TWord an unsigned integer type (e.g. DGtal::uint64_t).
+   */
+  template < Dimension dim,
+             typename TInteger = DGtal::int32_t,
+             typename TWord = DGtal::uint64_t >
+  struct PackedSignedKhalimskyCell
+  {
+    // Aliases
+  public:
+    using Integer  = TInteger;
+    using Word     = TWord;
+    using Point    = PointVector< dim, Integer >;
+    using SCell    = SignedKhalimskyCell< dim, Integer >;
+    using SPreCell = SignedKhalimskyPreCell< dim, Integer >;
+    using Unsigned = PackedKhalimskyCell< dim, Integer, Word >;
+    using Self     = PackedSignedKhalimskyCell< dim, Integer, Word >;
+
+    /// The bit of the sign.
+    static const constexpr Word signBit = ( (Word) 1 ) << ( 8 * sizeof( Word ) - 1 );
+
+  public:
+    /** @brief
+     * Default constructor (negative cell of null coordinates).
+     */
+    explicit PackedSignedKhalimskyCell( Integer dummy = 0 );
+
+    /** @brief Implicit constructor from a signed cell.
+     * @param aCell any signed cell with representable coordinates.
+     */
+    PackedSignedKhalimskyCell( const SCell & aCell );
+
+    /// @return the corresponding SignedKhalimskyCell.
+    SCell cell() const;
+
+    /// Implicit conversion to SignedKhalimskyPreCell.
+    operator SPreCell() const;
+
+    /// @return the underlying signed pre-cell.
+    SPreCell preCell() const;
+
+    /// @return the packed coordinates and sign.
+    Word word() const;
+
+    /** @brief Equality operator.
+     * @param other any other cell.
+     */
+    bool operator==( const PackedSignedKhalimskyCell & other ) const;
+
+    /** @brief Difference operator.
+     * @param other any other cell.
+     */
+    bool operator!=( const PackedSignedKhalimskyCell & other ) const;
+
+    /** @brief Inferior operator (sign, then lexicographic order).
+     * @param other any other cell.
+     */
+    bool operator<( const PackedSignedKhalimskyCell & other ) const;
+
+    /** @brief Return the style name used for drawing this object.
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+  private:
+    /// Packed Khalimsky coordinates and sign.
+    Word myWord;
+  };
+
+  template < Dimension dim, typename TInteger, typename TWord >
+  std::ostream &
+  operator<<( std::ostream & out,
+              const PackedSignedKhalimskyCell< dim, TInteger, TWord > & object );
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedKhalimskySpaceND
+  /**
+   * Description of template class 'PackedKhalimskySpaceND' <p>
+   * \brief Aim: A KhalimskySpaceND whose cells (types Cell, SCell,
+   * Surfel and the associated sets and maps) are packed into a single
+   * word, for spaces whose bounds fit into the word.
+   *
+   * A 3D cell takes 8 bytes with the default 64 bits word (instead of
+   * 12 bytes, and 16 bytes for a signed cell), so that sets and maps
+   * of cells or surfels are smaller, and comparing or hashing cells
+   * only reads one word. The Khalimsky coordinates have
+   * PackedKhalimskyCell::bitsPerCoordinate bits, i.e. 21 bits in 3D
+   * and 31 bits in 2D with 64 bits words: init fails if the bounds do
+   * not fit.
+   *
+   * The space is a model of CCellularGridSpaceND with the same
+   * services as KhalimskySpaceND: each service taking or returning
+   * cells unpacks its arguments, calls KhalimskySpaceND and packs its
+   * result. Hence algorithms written for a model of
+   * CCellularGridSpaceND (trackers, digital surfaces, estimators) can
+   * use it unchanged. Khalimsky coordinates are returned by value.
+   *
+   * @code
+   * typedef PackedKhalimskySpaceND< 3, DGtal::int32_t > KSpace;
+   * KSpace K;
+   * K.init( lower, upper, true );
+   * KSpace::SurfelSet boundary; // 8 bytes per surfel
+   * Surfaces< KSpace >::sMakeBoundary( boundary, K, predicate, lower, upper );
+   * @endcode
+   *
+   * @tparam dim the dimension of the digital space.
+   * @tparam TInteger the Integer class used to specify the arithmetic computations (default type = int32).
+   * @tparam TWord the unsigned integer type of packed cells.
+   *
+   * @see testPackedKhalimskySpaceND.cpp
+   */
+  template < Dimension dim,
+             typename TInteger = DGtal::int32_t,
+             typename TWord = DGtal::uint64_t >
+  class PackedKhalimskySpaceND
+    : public KhalimskySpaceND< dim, TInteger >
+  {
+  public:
+    typedef KhalimskySpaceND< dim, TInteger >                  Base;
+    typedef PackedKhalimskySpaceND< dim, TInteger, TWord >     Self;
+    typedef TWord                                              Word;
+    typedef typename Base::Integer                             Integer;
+    typedef typename Base::Size                                Size;
+    typedef typename Base::Space                               Space;
+    typedef Self                                               CellularGridSpace;
+    typedef typename Base::PreCellularGridSpace                PreCellularGridSpace;
+    typedef typename Base::Sign                                Sign;
+    typedef typename Base::DirIterator                         DirIterator;
+    typedef typename Base::Point                               Point;
+    typedef typename Base::Vector                              Vector;
+    typedef typename Base::Closure                             Closure;
+    typedef typename Base::PreCell                             PreCell;
+    typedef typename Base::SPreCell                            SPreCell;
+
+    // Cells
+    typedef PackedKhalimskyCell< dim, Integer, Word >          Cell;
+    typedef PackedSignedKhalimskyCell< dim, Integer, Word >    SCell;
+    typedef SCell                                              Surfel;
+
+    static const constexpr Dimension dimension = dim;
+    static const constexpr Dimension DIM = dim;
+    static const constexpr Sign POS = true;
+    static const constexpr Sign NEG = false;
+
+    // Neighborhoods, Incident cells
+    template < typename CellType >
+    using AnyCellCollection = typename Base::template AnyCellCollection< CellType >;
+
+    typedef AnyCellCollection< Cell >                          Cells;
+    typedef AnyCellCollection< SCell >                         SCells;
+
+    // Sets, Maps
+    /// Preferred type for defining a set of Cell(s).
+    typedef std::set<Cell> CellSet;
+
+    /// Preferred type for defining a set of SCell(s).
+    typedef std::set<SCell> SCellSet;
+
+    /// Preferred type for defining a set of surfels (always signed cells).
+    typedef std::set<SCell> SurfelSet;
+
+    /// Template rebinding for defining the type that is a mapping
+    /// Cell -> Value.
+    template <typename Value> struct CellMap {
+        typedef std::map<Cell,Value> Type;
+    };
+
+    /// Template rebinding for defining the type that is a mapping
+    /// SCell -> Value.
+    template <typename Value> struct SCellMap {
+        typedef std::map<SCell,Value> Type;
+    };
+
+    /// Template rebinding for defining the type that is a mapping
+    /// SCell -> Value.
+    template <typename Value> struct SurfelMap {
+        typedef std::map<SCell,Value> Type;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /** @brief Default constructor.
+     *
+     * The space is the largest one whose cells fit in packed cells.
+     */
+    PackedKhalimskySpaceND();
+
+    /** @brief Specifies the upper and lower bounds for the maximal cells in
+     * this space.
+     *
+     * @param lower the lowest point in this space (digital coords)
+     * @param upper the upper point in this space (digital coords)
+     * @param isClosed 'true' if this space is closed and non-periodic in every dimension, 'false' if open.
+     *
+     * @return true if the initialization was valid (ie, such bounds
+     * are representable with these integers and fit in packed cells).
+     */
+    bool init( const Point & lower,
+               const Point & upper,
+               bool isClosed );
+
+    /** @brief Specifies the upper and lower bounds for the maximal cells in
+     * this space.
+     *
+     * @param lower the lowest point in this space (digital coords)
+     * @param upper the upper point in this space (digital coords)
+     * @param closure \a CLOSED, \a OPEN or \a PERIODIC if this space is resp. closed (and non-periodic),
+     *        open or periodic in every dimension.
+     *
+     * @return true if the initialization was valid (ie, such bounds
+     * are representable with these integers and fit in packed cells).
+     */
+    bool init( const Point & lower,
+               const Point & upper,
+               Closure closure );
+
+    /** @brief Specifies the upper and lower bounds for the maximal cells in
+     * this space.
+     *
+     * @param lower the lowest point in this space (digital coords)
+     * @param upper the upper point in this space (digital coords)
+     * @param closure an array of \a CLOSED, \a OPEN or \a PERIODIC if this space is resp. closed (and non-periodic),
+     *        open or periodic in the corresponding dimension.
+     *
+     * @return true if the initialization was valid (ie, such bounds
+     * are representable with these integers and fit in packed cells).
+     */
+    bool init( const Point & lower,
+               const Point & upper,
+               const std::array<Closure, dim> & closure );
+
+    // ------------------------- Cells services -------------------------------
+    // The following services are those of KhalimskySpaceND, on packed cells.
+  public:
+
+    /// Returns the lowest cell in this space.
+    const Cell & lowerCell() const;
+
+    /// Returns the uppest cell in this space.
+    const Cell & upperCell() const;
+
+    /// Returns \c true if the given unsigned cell has his k-th Khalimsky coordinate between those of the cells returned by lowerCell and upperCell.
+    bool uIsValid( const PreCell & c, Dimension k ) const;
+    /// Returns \c true if the given unsigned cell has Khalimsky coordinates between those of the cells returned by lowerCell and upperCell.
+    bool uIsValid( const PreCell & c ) const;
+    /// Returns \c true if the given signed cell his k-th Khalimsky coordinate between those of the cells returned by lowerCell and upperCell.
+    bool sIsValid( const SPreCell & c, Dimension k ) const;
+    /// Returns \c true if the given signed cell has Khalimsky coordinates between those of the cells returned by lowerCell and upperCell.
+    bool sIsValid( const SPreCell & c ) const;
+    /// From an unsigned cell, returns an unsigned cell lying into this Khalismky space. Along a non-periodic dimension, if the given Khalimsky coordinate lies outside the space, it replaces it by the nearest valid coordinate. Along a periodic dimension, the Khalimsky coordinate is corrected (by periodicity) to lie between the coordinates of lowerCell() and upperCell().
+    Cell uCell( const PreCell & c ) const;
+    /// From the Khalimsky coordinates of a cell, builds the corresponding unsigned cell lying into this Khalismky space. Along a non-periodic dimension, if the given Khalimsky coordinate lies outside the space, it is replaced by the nearest valid coordinate. Along a periodic dimension, the Khalimsky coordinate is corrected (by periodicity) to lie between the coordinates of lowerCell() and upperCell().
+    Cell uCell( const Point & kp ) const;
+    /// From the digital coordinates of a point in Zn and a cell type, builds the corresponding unsigned cell lying into this Khalismky space. Along a non-periodic dimension, if the given digital coordinate lies outside the space, it is replaced by the nearest valid coordinate. Along a periodic dimension, the digital coordinate is corrected (by periodicity) to lie between the coordinates of lowerCell() and upperCell().
+    Cell uCell( Point p, const PreCell & c ) const;
+    /// From a signed cell, returns a signed cell lying into this Khalismky space. Along a non-periodic dimension, if the given Khalimsky coordinate lies outside the space, it replaces it by the nearest valid coordinate. Along a periodic dimension, the Khalimsky coordinate is corrected (by periodicity) to lie between the coordinates of lowerCell() and upperCell().
+    SCell sCell( const SPreCell & c ) const;
+    /// From the Khalimsky coordinates of a cell and a sign, builds the corresponding signed cell lying into this Khalismky space. Along a non-periodic dimension, if the given Khalimsky coordinate lies outside the space, it is replaced by the nearest valid coordinate. Along a periodic dimension, the Khalimsky coordinate is corrected (by periodicity) to lie between the coordinates of lowerCell() and upperCell().
+    SCell sCell( const Point & kp, Sign sign = POS ) const;
+    /// From the digital coordinates of a point in Zn and a signed cell type, builds the corresponding signed cell lying into this Khalismky space. Along a non-periodic dimension, if the given digital coordinate lies outside the space, it is replaced by the nearest valid coordinate. Along a periodic dimension, the digital coordinate is corrected (by periodicity) to lie between the coordinates of lowerCell() and upperCell().
+    SCell sCell( Point p, const SPreCell & c ) const;
+    /// From the digital coordinates of a point in Zn, builds the corresponding spel (cell of maximal dimension) lying into this Khalismky space. Along a non-periodic dimension, if the given digital coordinate lies outside the space, it is replaced by the nearest valid coordinate. Along a periodic dimension, the digital coordinate is corrected (by periodicity) to lie between the coordinates of lowerCell() and upperCell().
+    Cell uSpel( Point p ) const;
+    /// From the digital coordinates of a point in Zn, builds the corresponding spel (cell of maximal dimension) lying into this Khalismky space. Along a non-periodic dimension, if the given digital coordinate lies outside the space, it is replaced by the nearest valid coordinate. Along a periodic dimension, the digital coordinate is corrected (by periodicity) to lie between the coordinates of lowerCell() and upperCell().
+    SCell sSpel( Point p, Sign sign = POS ) const;
+    /// From the digital coordinates of a point in Zn, builds the corresponding pointel (cell of dimension 0) lying into this Khalismky space. Along a non-periodic dimension, if the given digital coordinate lies outside the space, it is replaced by the nearest valid coordinate. Along a periodic dimension, the digital coordinate is corrected (by periodicity) to lie between the coordinates of lowerCell() and upperCell().
+    Cell uPointel( Point p ) const;
+    /// From the digital coordinates of a point in Zn, builds the corresponding pointel (cell of dimension 0) lying into this Khalismky space. Along a non-periodic dimension, if the given digital coordinate lies outside the space, it is replaced by the nearest valid coordinate. Along a periodic dimension, the digital coordinate is corrected (by periodicity) to lie between the coordinates of lowerCell() and upperCell().
+    SCell sPointel( Point p, Sign sign = POS ) const;
+    /// Return its Khalimsky coordinate along [k].
+    Integer uKCoord( const Cell & c, Dimension k ) const;
+    /// Return its digital coordinate along [k].
+    Integer uCoord( const Cell & c, Dimension k ) const;
+    /// Return its Khalimsky coordinates.
+    Point uKCoords( const Cell & c ) const;
+    /// Return its digital coordinates
+    Point uCoords( const Cell & c ) const;
+    /// Return its Khalimsky coordinate along [k].
+    Integer sKCoord( const SCell & c, Dimension k ) const;
+    /// Return its digital coordinate along [k].
+    Integer sCoord( const SCell & c, Dimension k ) const;
+    /// Return its Khalimsky coordinates.
+    Point sKCoords( const SCell & c ) const;
+    /// Return its digital coordinates.
+    Point sCoords( const SCell & c ) const;
+    /// Return its sign.
+    Sign sSign( const SCell & c ) const;
+    /// Sets the [k]-th Khalimsky coordinate of [c] to [i].
+    void uSetKCoord( Cell & c, Dimension k, Integer i ) const;
+    /// Sets the [k]-th Khalimsky coordinate of [c] to [i].
+    void sSetKCoord( SCell & c, Dimension k, Integer i ) const;
+    /// Sets the [k]-th digital coordinate of [c] to [i].
+    void uSetCoord( Cell & c, Dimension k, Integer i ) const;
+    /// Sets the [k]-th digital coordinate of [c] to [i].
+    void sSetCoord( SCell & c, Dimension k, Integer i ) const;
+    /// Sets the Khalimsky coordinates of [c] to [kp].
+    void uSetKCoords( Cell & c, const Point & kp ) const;
+    /// Sets the Khalimsky coordinates of [c] to [kp].
+    void sSetKCoords( SCell & c, const Point & kp ) const;
+    /// Sets the digital coordinates of [c] to [kp].
+    void uSetCoords( Cell & c, const Point & kp ) const;
+    /// Sets the digital coordinates of [c] to [kp].
+    void sSetCoords( SCell & c, const Point & kp ) const;
+    /// Sets the sign of the cell.
+    void sSetSign( SCell & c, Sign s ) const;
+    /// Creates a signed cell from an unsigned one and a given sign.
+    SCell signs( const Cell & p, Sign s ) const;
+    /// Creates an unsigned cell from a signed one.
+    Cell unsigns( const SCell & p ) const;
+    /// Creates the signed cell with the inverse sign of [p].
+    SCell sOpp( const SCell & p ) const;
+    /// Return the topology word of [p].
+    Integer uTopology( const Cell & p ) const;
+    /// Return the topology word of [p].
+    Integer sTopology( const SCell & p ) const;
+    /// Return the dimension of the cell [p].
+    Dimension uDim( const Cell & p ) const;
+    /// Return the dimension of the cell [p].
+    Dimension sDim( const SCell & p ) const;
+    /// Return 'true' if [b] is a surfel (spans all but one coordinate).
+    bool uIsSurfel( const Cell & b ) const;
+    /// Return 'true' if [b] is a surfel (spans all but one coordinate).
+    bool sIsSurfel( const SCell & b ) const;
+    /// Return 'true' if [p] is open along the direction [k].
+    bool uIsOpen( const Cell & p, Dimension k ) const;
+    /// Return 'true' if [p] is open along the direction [k].
+    bool sIsOpen( const SCell & p, Dimension k ) const;
+    /// Given an unsigned cell [p], returns an iterator to iterate over each coordinate the cell spans. (A spel spans all coordinates; a surfel all but one, etc). Example: @code KSpace::Cell p; ... for ( KSpace::DirIterator q = ks.uDirs( p ); q != 0; ++q ) { Dimension dir = *q; ... } @endcode
+    DirIterator uDirs( const Cell & p ) const;
+    /// Given a signed cell [p], returns an iterator to iterate over each coordinate the cell spans. (A spel spans all coordinates; a surfel all but one, etc). Example: @code KSpace::SCell p; ... for ( KSpace::DirIterator q = ks.uDirs( p ); q != 0; ++q ) { Dimension dir = *q; ... } @endcode
+    DirIterator sDirs( const SCell & p ) const;
+    /// Given an unsigned cell [p], returns an iterator to iterate over each coordinate the cell does not span. (A spel spans all coordinates; a surfel all but one, etc). Example: @code KSpace::Cell p; ... for ( KSpace::DirIterator q = ks.uOrthDirs( p ); q != 0; ++q ) { Dimension dir = *q; ... } @endcode
+    DirIterator uOrthDirs( const Cell & p ) const;
+    /// Given a signed cell [p], returns an iterator to iterate over each coordinate the cell does not span. (A spel spans all coordinates; a surfel all but one, etc). Example: @code KSpace::SCell p; ... for ( KSpace::DirIterator q = ks.uOrthDirs( p ); q != 0; ++q ) { Dimension dir = *q; ... } @endcode
+    DirIterator sOrthDirs( const SCell & p ) const;
+    /// Given an unsigned surfel [s], returns its orthogonal direction (ie, the coordinate where the surfel is closed).
+    Dimension uOrthDir( const Cell & s ) const;
+    /// Given a signed surfel [s], returns its orthogonal direction (ie, the coordinate where the surfel is closed).
+    Dimension sOrthDir( const SCell & s ) const;
+    /// Return the k-th Khalimsky coordinate of the first cell of the space with the same type as [p].
+    Integer uFirst( const PreCell & p, Dimension k ) const;
+    /// Return the first cell of the space with the same type as [p].
+    Cell uFirst( const PreCell & p ) const;
+    /// Return the k-th Khalimsky coordinate of the last cell of the space with the same type as [p].
+    Integer uLast( const PreCell & p, Dimension k ) const;
+    /// Return the last cell of the space with the same type as [p].
+    Cell uLast( const PreCell & p ) const;
+    /// Return the same element as [p] except for the incremented coordinate [k].
+    Cell uGetIncr( const Cell & p, Dimension k ) const;
+    /// Useful to check if you are going out of the space.
+    bool uIsMax( const Cell & p, Dimension k ) const;
+    /// Useful to check if you are going out of the space.
+    bool uIsInside( const PreCell & p, Dimension k ) const;
+    /// Useful to check if you are going out of the space.
+    bool uIsInside( const PreCell & p ) const;
+    /// Useful to check if you are going out of the space.
+    Cell uGetMax( Cell p, Dimension k ) const;
+    /// Return the same element as [p] except for an decremented coordinate [k].
+    Cell uGetDecr( const Cell & p, Dimension k ) const;
+    /// Useful to check if you are going out of the space.
+    bool uIsMin( const Cell & p, Dimension k ) const;
+    /// Useful to check if you are going out of the space.
+    Cell uGetMin( Cell p, Dimension k ) const;
+    /// Return the same element as [p] except for a coordinate [k] incremented with x.
+    Cell uGetAdd( const Cell & p, Dimension k, Integer x ) const;
+    /// Return the same element as [p] except for a coordinate [k] decremented with x.
+    Cell uGetSub( const Cell & p, Dimension k, Integer x ) const;
+    /// Useful to check if you are going out of the space (for non-periodic dimensions).
+    Integer uDistanceToMax( const Cell & p, Dimension k ) const;
+    /// Useful to check if you are going out of the space (for non-periodic dimensions).
+    Integer uDistanceToMin( const Cell & p, Dimension k ) const;
+    /// Add the vector [vec] to [p].
+    Cell uTranslation( const Cell & p, const Vector & vec ) const;
+    /// Return the projection of [p] along the [k]th direction toward [bound]. Otherwise said, p[ k ] == bound[ k ] afterwards.
+    Cell uProjection( const Cell & p, const Cell & bound, Dimension k ) const;
+    /// Projects [p] along the [k]th direction toward [bound]. Otherwise said, p[ k ] == bound[ k ] afterwards
+    void uProject( Cell & p, const Cell & bound, Dimension k ) const;
+    /// Increment the cell [p] to its next position (as classically done in a scanning). Example: \code KSpace K; Cell first, last; // lower and upper bounds Cell p = first; do { // ... whatever [p] is the current cell } while ( K.uNext( p, first, last ) ); \endcode
+    bool uNext( Cell & p, const Cell & lower, const Cell & upper ) const;
+    /// Return the k-th coordinate of the first cell of the space with the same type as [p].
+    Integer sFirst( const SPreCell & p, Dimension k ) const;
+    /// Return the first cell of the space with the same type as [p].
+    SCell sFirst( const SPreCell & p ) const;
+    /// Return the k-th Khalimsky coordinate of the last cell of the space with the same type as [p].
+    Integer sLast( const SPreCell & p, Dimension k ) const;
+    /// Return the last cell of the space with the same type as [p].
+    SCell sLast( const SPreCell & p ) const;
+    /// Return the same element as [p] except for the incremented coordinate [k].
+    SCell sGetIncr( const SCell & p, Dimension k ) const;
+    /// Useful to check if you are going out of the space.
+    bool sIsMax( const SCell & p, Dimension k ) const;
+    /// Useful to check if you are going out of the space.
+    bool sIsInside( const SPreCell & p, Dimension k ) const;
+    /// Useful to check if you are going out of the space.
+    bool sIsInside( const SPreCell & p ) const;
+    /// Useful to check if you are going out of the space.
+    SCell sGetMax( SCell p, Dimension k ) const;
+    /// Return the same element as [p] except for an decremented coordinate [k].
+    SCell sGetDecr( const SCell & p, Dimension k ) const;
+    /// Useful to check if you are going out of the space.
+    bool sIsMin( const SCell & p, Dimension k ) const;
+    /// Useful to check if you are going out of the space.
+    SCell sGetMin( SCell p, Dimension k ) const;
+    /// Return the same element as [p] except for a coordinate [k] incremented with x.
+    SCell sGetAdd( const SCell & p, Dimension k, Integer x ) const;
+    /// Return the same element as [p] except for a coordinate [k] decremented with x.
+    SCell sGetSub( const SCell & p, Dimension k, Integer x ) const;
+    /// Useful to check if you are going out of the space (for non-periodic dimensions).
+    Integer sDistanceToMax( const SCell & p, Dimension k ) const;
+    /// Useful to check if you are going out of the space (for non-periodic dimensions).
+    Integer sDistanceToMin( const SCell & p, Dimension k ) const;
+    /// Add the vector [vec] to [p].
+    SCell sTranslation( const SCell & p, const Vector & vec ) const;
+    /// Return the projection of [p] along the [k]th direction toward [bound]. Otherwise said, p[ k ] == bound[ k ] afterwards.
+    SCell sProjection( const SCell & p, const SCell & bound, Dimension k ) const;
+    /// Projects [p] along the [k]th direction toward [bound]. Otherwise said, p[ k ] == bound[ k ] afterwards.
+    void sProject( SCell & p, const SCell & bound, Dimension k ) const;
+    /// Increment the cell [p] to its next position (as classically done in a scanning). Example: \code KSpace K; Cell first, last; // lower and upper bounds Cell p = first; do { // ... whatever [p] is the current cell } while ( K.uNext( p, first, last ) ); \endcode
+    bool sNext( SCell & p, const SCell & lower, const SCell & upper ) const;
+    /// Computes the 1-neighborhood of the cell [c] and returns it. It is the set of cells with same topology that are adjacent to [c] and which are within the bounds of this space.
+    Cells uNeighborhood( const Cell & cell ) const;
+    /// Computes the 1-neighborhood of the cell [c] and returns it. It is the set of cells with same topology that are adjacent to [c] and which are within the bounds of this space.
+    SCells sNeighborhood( const SCell & cell ) const;
+    /// Computes the proper 1-neighborhood of the cell [c] and returns it. It is the set of cells with same topology that are adjacent to [c], different from [c] and which are within the bounds of this space.
+    Cells uProperNeighborhood( const Cell & cell ) const;
+    /// Computes the proper 1-neighborhood of the cell [c] and returns it. It is the set of cells with same topology that are adjacent to [c], different from [c] and which are within the bounds of this space.
+    SCells sProperNeighborhood( const SCell & cell ) const;
+    /// Return the adjacent element to [p] along axis [k] in the given direction and orientation.
+    Cell uAdjacent( const Cell & p, Dimension k, bool up ) const;
+    /// Return the adjacent element to [p] along axis [k] in the given direction and orientation.
+    SCell sAdjacent( const SCell & p, Dimension k, bool up ) const;
+    /// Return the forward or backward unsigned cell incident to [c] along axis [k], depending on [up].
+    Cell uIncident( const Cell & c, Dimension k, bool up ) const;
+    /// Return the forward or backward signed cell incident to [c] along axis [k], depending on [up].
+    SCell sIncident( const SCell & c, Dimension k, bool up ) const;
+    /// Return the cells directly low incident to c in this space.
+    Cells uLowerIncident( const Cell & c ) const;
+    /// Return the cells directly up incident to c in this space.
+    Cells uUpperIncident( const Cell & c ) const;
+    /// Return the signed cells directly low incident to c in this space.
+    SCells sLowerIncident( const SCell & c ) const;
+    /// Return the signed cells directly up incident to c in this space.
+    SCells sUpperIncident( const SCell & c ) const;
+    /// Return the proper faces of [c] (chain of lower incidence) that belong to the space.
+    Cells uFaces( const Cell & c ) const;
+    /// Return the proper cofaces of [c] (chain of upper incidence) that belong to the space.
+    Cells uCoFaces( const Cell & c ) const;
+    /// Return 'true' if the direct orientation of [p] along [k] is in the positive coordinate direction. The direct orientation in a direction allows to go from positive incident cells to positive incident cells. This means that @code K.sSign( K.sIncident( p, k, K.sDirect( p, k ) ) ) == K.POS @endcode is always true.
+    bool sDirect( const SCell & p, Dimension k ) const;
+    /// Return the direct incident cell of [p] along [k] (the incident cell along [k])
+    SCell sDirectIncident( const SCell & p, Dimension k ) const;
+    /// Return the indirect incident cell of [p] along [k] (the incident cell along [k] whose sign is negative).
+    SCell sIndirectIncident( const SCell & p, Dimension k ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+    typedef typename Base::Cell  BaseCell;
+    typedef typename Base::SCell BaseSCell;
+
+    /**
+     * @param lower the lowest point (digital coords)
+     * @param upper the upper point (digital coords)
+     * @return 'true' if the Khalimsky coordinates of the cells between
+     * \a lower and \a upper fit in packed cells.
+     */
+    static bool fitsInPackedCells( const Point & lower, const Point & upper );
+
+    /// Updates the packed lower and upper cells after an init.
+    /// @param ok the value returned by the init of KhalimskySpaceND.
+    /// @return 'true' if \a ok and the cells fit in packed cells.
+    bool initPackedCells( bool ok );
+
+    /// @return the unpacked cell \a c.
+    static BaseCell  toBase( const Cell & c );
+
+    /// @return the unpacked signed cell \a c.
+    static BaseSCell toBase( const SCell & c );
+
+    /// @return the collection \a cells with packed cells.
+    template < typename TCells, typename TBaseCells >
+    static TCells convert( const TBaseCells & cells );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The lowest cell of the space, packed.
+    Cell myPackedLowerCell;
+    /// The uppest cell of the space, packed.
+    Cell myPackedUpperCell;
+
+  }; // end of class PackedKhalimskySpaceND
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedKhalimskySpaceND'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedKhalimskySpaceND' to write.
+   * @return the output stream after the writing.
+   */
+  template < Dimension dim, typename TInteger, typename TWord >
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const PackedKhalimskySpaceND< dim, TInteger, TWord > & object );
+
+} // namespace DGtal
+
+namespace std {
+  /** @brief
+   * Extend std namespace to define a std::hash function on
+   * DGtal::PackedKhalimskyCell.
+   */
+  template < DGtal::Dimension dim, typename TInteger, typename TWord >
+  struct hash< DGtal::PackedKhalimskyCell< dim, TInteger, TWord > >
+  {
+    size_t operator()( const DGtal::PackedKhalimskyCell< dim, TInteger, TWord > & c ) const
+    {
+      return boost::hash_value( c.word() );
+    }
+  };
+
+  /** @brief
+   * Extend std namespace to define a std::hash function on
+   * DGtal::PackedSignedKhalimskyCell.
+   */
+  template < DGtal::Dimension dim, typename TInteger, typename TWord >
+  struct hash< DGtal::PackedSignedKhalimskyCell< dim, TInteger, TWord > >
+  {
+    size_t operator()( const DGtal::PackedSignedKhalimskyCell< dim, TInteger, TWord > & c ) const
+    {
+      return boost::hash_value( c.word() );
+    }
+  };
+}
+
+namespace boost {
+  /** @brief
+   * Extend boost namespace to define a boost::hash function on
+   * DGtal::PackedKhalimskyCell.
+   */
+  template < DGtal::Dimension dim, typename TInteger, typename TWord >
+  struct hash< DGtal::PackedKhalimskyCell< dim, TInteger, TWord > >
+  {
+    size_t operator()( const DGtal::PackedKhalimskyCell< dim, TInteger, TWord > & c ) const
+    {
+      return boost::hash_value( c.word() );
+    }
+  };
+
+  /** @brief
+   * Extend boost namespace to define a boost::hash function on
+   * DGtal::PackedSignedKhalimskyCell.
+   */
+  template < DGtal::Dimension dim, typename TInteger, typename TWord >
+  struct hash< DGtal::PackedSignedKhalimskyCell< dim, TInteger, TWord > >
+  {
+    size_t operator()( const DGtal::PackedSignedKhalimskyCell< dim, TInteger, TWord > & c ) const
+    {
+      return boost::hash_value( c.word() );
+    }
+  };
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/PackedKhalimskySpaceND.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedKhalimskySpaceND_h
+
+#undef PackedKhalimskySpaceND_RECURSES
+#endif // else defined(PackedKhalimskySpaceND_RECURSES)
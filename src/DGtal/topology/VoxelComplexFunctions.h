@@ -44,6 +44,7 @@
 #include <iostream>
 #include "DGtal/base/Common.h"
 #include "DGtal/topology/VoxelComplex.h"
+#include "DGtal/topology/VoxelThinning.h"
 //////////////////////////////////////////////////////////////////////////////
 namespace DGtal
 {
@@ -81,6 +82,41 @@ namespace DGtal
        uint32_t persistence,
        bool verbose = false
     );
+
+    /**
+     * Thinning of the voxels of a VoxelComplex with VoxelThinning:
+     * the voxels are copied into a bit image, thinned in parallel by
+     * subfields with the simplicity table of the complex, and the
+     * remaining voxels are returned as a new complex.
+     *
+     * Unlike asymetricThinningScheme, the skeleton predicate works on
+     * neighborhood configurations, see VoxelThinning::skelEnd and
+     * VoxelThinning::skelWithTable.
+     *
+     * @tparam TComplex a VoxelComplex in 3D.
+     * @param vc input complex, with a loaded simplicity table.
+     * @param Skel the skeleton predicate (empty for an ultimate skeleton).
+     * @param persistence see persistenceAsymetricThinningScheme (0
+     * keeps the voxels as soon as they satisfy @a Skel).
+     * @param nbThreads the number of threads (0 means as many as the
+     * hardware supports).
+     * @param verbose print messages.
+     *
+     * @return the thinned complex.
+     */
+    template < typename TComplex >
+    TComplex
+    parallelThinningScheme(
+       const TComplex & vc ,
+       std::function<
+       bool(
+         const typename TComplex::Point & ,
+         NeighborhoodConfiguration )
+       > Skel,
+       uint32_t persistence = 0,
+       unsigned int nbThreads = 1,
+       bool verbose = false
+    );
 //////////////////////////////////////////////////////////////////////////////
 // Select Functions
     /**
@@ -0,0 +1,328 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file VoxelThinning.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module VoxelThinning.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(VoxelThinning_RECURSES)
+#error Recursive header files inclusion detected in VoxelThinning.h
+#else // defined(VoxelThinning_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define VoxelThinning_RECURSES
+
+#if !defined VoxelThinning_h
+/** Prevents repeated inclusion of headers. */
+#define VoxelThinning_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "boost/dynamic_bitset.hpp"
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/CountedConstPtrOrConstPtr.h"
+#include "DGtal/base/ParallelFor.h"
+#include "DGtal/images/ImageContainerByBits.h"
+#include "DGtal/topology/helpers/NeighborhoodConfigurationsHelper.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class VoxelThinning
+  /**
+   * Description of template class 'VoxelThinning' <p>
+   * \brief Aim: A thinning engine for 3D binary images stored with one
+   * bit per voxel, driven by look up tables of neighborhood
+   * configurations and parallel by subfields.
+   *
+   * The voxels are split into 8 subfields according to the parities
+   * of their coordinates, so that no two voxels of a subfield are
+   * 26-adjacent. A sweep processes the subfields one after the other:
+   * the simple voxels of a subfield (given by a simplicity table,
+   * e.g. simplicity::tableSimple26_6) are all found in parallel, then
+   * removed together, which preserves the topology as if they were
+   * removed one by one. Sweeps are repeated until no voxel is
+   * removed. The neighborhood configuration of a voxel is read from
+   * the bits of the 9 rows around it (see
+   * functions::mapZeroPointNeighborhoodToConfigurationMask for the
+   * order of the bits).
+   *
+   * Only voxels whose neighborhood has changed since their last
+   * evaluation are evaluated again, and only rows holding such
+   * voxels are visited. The result does not depend on the number of
+   * threads.
+   *
+   * Like functions::asymetricThinningScheme and
+   * functions::persistenceAsymetricThinningScheme, the thinning keeps
+   * the voxels which satisfy a skeleton predicate (see skelEnd,
+   * skelWithTable), possibly after they have satisfied it during a
+   * given number of generations (a generation is a sweep over the 8
+   * subfields). The role of the selection functions of these schemes
+   * (e.g. functions::selectMaxValue with a distance map) is played by
+   * an optional priority: voxels are only removed once all the
+   * voxels of lower priority have been processed.
+   *
+   * @code
+   * typedef VoxelThinning< Z3i::Domain > Thinning;
+   * Thinning thinning( image, functions::loadTable( simplicity::tableSimple26_6 ), 0 );
+   * thinning.thin( Thinning::skelWithTable( functions::loadTable( isthmusicity::tableIsthmus ) ) );
+   * const Thinning::BinaryImage & skeleton = thinning.image();
+   * @endcode
+   *
+   * @tparam TDomain the type of domain, a 3D HyperRectDomain.
+   *
+   * @see testVoxelThinning.cpp
+   * @see functions::parallelThinningScheme
+   */
+  template < typename TDomain >
+  class VoxelThinning
+  {
+  public:
+    typedef VoxelThinning< TDomain >           Self;
+    typedef TDomain                            Domain;
+    typedef typename Domain::Point             Point;
+    typedef typename Domain::Integer           Integer;
+    typedef ImageContainerByBits< Domain >     BinaryImage;
+    typedef typename BinaryImage::Size         Size;
+    typedef typename BinaryImage::Word         Word;
+    /// Type of look up tables: table[configuration] -> bool.
+    typedef boost::dynamic_bitset<>            ConfigMap;
+    /// Predicate telling if a voxel belongs to the skeleton, from its
+    /// point and its neighborhood configuration. An empty predicate
+    /// keeps no voxel (ultimate skeleton).
+    typedef std::function< bool( const Point &, NeighborhoodConfiguration ) > SkelPredicate;
+    /// Priority of a voxel: voxels of lower priority are removed
+    /// first. An empty function gives the same priority to all voxels.
+    typedef std::function< double( const Point & ) > Priority;
+
+    BOOST_STATIC_ASSERT_MSG( Domain::dimension == 3, "VoxelThinning is only defined in 3D." );
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param anImage the voxels to thin (copied, as a BIT_PACKED image).
+     * @param aSimplicityTable the table[configuration] -> bool telling
+     * which voxels are simple (e.g. loaded from simplicity::tableSimple26_6).
+     * @param nbThreads the number of threads (0 means as many as the
+     * hardware supports).
+     */
+    VoxelThinning( const BinaryImage & anImage,
+                   ConstAlias< ConfigMap > aSimplicityTable,
+                   unsigned int nbThreads = 1 );
+
+    /**
+     * Destructor.
+     */
+    ~VoxelThinning() = default;
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    VoxelThinning( const Self & other ) = default;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    Self & operator=( const Self & other ) = default;
+
+    // ----------------------- Skeleton predicates ----------------------------
+  public:
+
+    /**
+     * @return an empty predicate: no voxel is kept for itself, which
+     * gives an ultimate skeleton (see functions::skelUltimate).
+     */
+    static SkelPredicate skelUltimate();
+
+    /**
+     * @return a predicate keeping voxels with exactly one neighbor in
+     * the object (see functions::skelEnd).
+     */
+    static SkelPredicate skelEnd();
+
+    /**
+     * @param aTable a table[configuration] -> bool, e.g. loaded from
+     * isthmusicity::tableIsthmus, tableOneIsthmus or tableTwoIsthmus.
+     * @return a predicate keeping voxels whose configuration is true
+     * in the table (see functions::skelWithTable).
+     */
+    static SkelPredicate skelWithTable( ConstAlias< ConfigMap > aTable );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Thins the object until no voxel can be removed.
+     *
+     * @param skel the skeleton predicate (voxels satisfying it are
+     * kept until the end).
+     *
+     * @param persistence a voxel is kept if it has satisfied @a skel
+     * for at least @a persistence generations (0 or 1 means as soon
+     * as it satisfies it), see
+     * functions::persistenceAsymetricThinningScheme.
+     *
+     * @param priority the priority of the voxels, which must be
+     * callable from several threads at once.
+     *
+     * @return the number of removed voxels.
+     */
+    Size thin( const SkelPredicate & skel = SkelPredicate(),
+               DGtal::uint32_t persistence = 0,
+               const Priority & priority = Priority() );
+
+    /// @return the current voxels.
+    const BinaryImage & image() const;
+
+    /// @return the voxels that are kept because they satisfied the
+    /// skeleton predicate (and its persistence).
+    const BinaryImage & constraints() const;
+
+    /// @return the number of generations of the last thinning.
+    DGtal::uint32_t generation() const;
+
+    /**
+     * @param aPoint any point of the domain.
+     * @return the configuration of the 26 neighbors of @a aPoint in
+     * the current voxels.
+     */
+    NeighborhoodConfiguration configuration( const Point & aPoint ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The simplicity table.
+    CountedConstPtrOrConstPtr< ConfigMap > myTable;
+    /// The number of threads.
+    unsigned int myNbThreads;
+    /// The current voxels.
+    BinaryImage myImage;
+    /// The voxels kept by the skeleton predicate.
+    BinaryImage myConstraints;
+    /// The voxels to evaluate.
+    BinaryImage myCandidates;
+    /// The voxels removed in the current subfield.
+    BinaryImage myRemoved;
+    /// For each row, 1 if it has voxels to evaluate.
+    std::vector< char > myActiveRows;
+    /// For each row, 1 if it has voxels removed in the current subfield.
+    std::vector< char > myRemovedRows;
+    /// The generation at which voxels first satisfied the skeleton
+    /// predicate (with persistence), indexed by row * width + x.
+    std::unordered_map< Size, DGtal::uint32_t > myBirths;
+    /// The current generation.
+    DGtal::uint32_t myGeneration;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Default constructor.
+     */
+    VoxelThinning() = delete;
+
+    /**
+     * @param rows the 9 rows around a voxel, (dy,dz) being at index
+     * (dy+1)+3(dz+1), or 0 outside the domain.
+     * @param x the position of the voxel along its row.
+     * @return the configuration of the 26 neighbors of the voxel.
+     */
+    NeighborhoodConfiguration configuration( const Word * const * rows, Size x ) const;
+
+    /**
+     * Gets the 9 rows around a row.
+     * @param aRow a row index.
+     * @param rows (returns) the 9 rows, see configuration.
+     */
+    void neighborRows( Size aRow, const Word ** rows ) const;
+
+    /**
+     * Processes a subfield: finds the voxels to remove, removes them
+     * and marks their neighbors as voxels to evaluate.
+     *
+     * @param subfield the subfield, whose bits 0, 1 and 2 are the
+     * parities of the coordinates (relative to the lower bound).
+     * @param skel the skeleton predicate.
+     * @param persistence the persistence.
+     * @param priority the priority.
+     * @param level only voxels of priority at most @a level are processed.
+     * @param nextLevel (updated) the minimal priority of the postponed voxels.
+     * @return the number of removed voxels.
+     */
+    Size thinSubfield( unsigned int subfield,
+                       const SkelPredicate & skel,
+                       DGtal::uint32_t persistence,
+                       const Priority & priority,
+                       double level, double & nextLevel );
+
+  }; // end of class VoxelThinning
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'VoxelThinning'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'VoxelThinning' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TDomain >
+  std::ostream&
+  operator<< ( std::ostream & out, const VoxelThinning< TDomain > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/VoxelThinning.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined VoxelThinning_h
+
+#undef VoxelThinning_RECURSES
+#endif // else defined(VoxelThinning_RECURSES)
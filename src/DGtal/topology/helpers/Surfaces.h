@@ -43,6 +43,8 @@
 #include <iostream>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Exceptions.h"
+#include "DGtal/base/ParallelFor.h"
+#include "DGtal/images/ImageContainerByBits.h"
 #include "DGtal/topology/SurfelAdjacency.h"
 #include "DGtal/topology/SurfelNeighborhood.h"
 
@@ -776,6 +778,106 @@ namespace DGtal
                          const PointPredicate & pp,
                          const Point & aLowerBound, 
                          const Point & aUpperBound  );
+
+    /**
+       Creates a set of unsigned surfels whose elements represents all
+       the boundary components of the digital shape given by a binary
+       image stored with one bit per point. Same result as the generic
+       uMakeBoundary, but computed word by word (see sWriteBitBoundary).
+
+       @tparam CellSet a model of a set of Cell (e.g., std::set<Cell>).
+       @tparam TDomain the (hyper-rectangular) domain of the image.
+
+       @param aBoundary (modified) a set of cells (which are all surfels),
+       the boundary component of the shape.
+
+       @param aKSpace any space.
+       @param image a binary image, whose domain contains the bounds.
+
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+
+       @param nbThreads the number of threads (0 means as many as the
+       hardware supports).
+    */
+    template <typename CellSet, typename TDomain >
+    static
+    void uMakeBoundary( CellSet & aBoundary,
+                        const KSpace & aKSpace,
+                        const ImageContainerByBits<TDomain> & image,
+                        const Point & aLowerBound,
+                        const Point & aUpperBound,
+                        unsigned int nbThreads = 1 );
+
+    /**
+       Creates a set of signed surfels whose elements represents all
+       the boundary components of the digital shape given by a binary
+       image stored with one bit per point. Same result as the generic
+       sMakeBoundary, but computed word by word (see sWriteBitBoundary).
+
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+       @tparam TDomain the (hyper-rectangular) domain of the image.
+
+       @param aBoundary (modified) a set of cells (which are all surfels),
+       the boundary component of the shape.
+
+       @param aKSpace any space.
+       @param image a binary image, whose domain contains the bounds.
+
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+
+       @param nbThreads the number of threads (0 means as many as the
+       hardware supports).
+    */
+    template <typename SCellSet, typename TDomain >
+    static
+    void sMakeBoundary( SCellSet & aBoundary,
+                        const KSpace & aKSpace,
+                        const ImageContainerByBits<TDomain> & image,
+                        const Point & aLowerBound,
+                        const Point & aUpperBound,
+                        unsigned int nbThreads = 1 );
+
+    /**
+       Writes on the output iterator @a out_it the signed surfels of
+       the boundary of the digital shape given by a binary image stored
+       with one bit per point. Surfels are oriented as in sMakeBoundary.
+
+       Instead of querying the image point by point, rows of the image
+       are compared as words of bits: the XOR of a row with itself
+       shifted by one bit gives the surfels orthogonal to the first
+       axis, the XOR of a row with its neighbor row along axis k gives
+       the surfels orthogonal to axis k. Rows are distributed among
+       threads, each one gathering its surfels in its own buffer.
+
+       Surfels are written row by row, in the order of the rows of the
+       image, then direction by direction, then along the row. This
+       order does not depend on the number of threads.
+
+       @tparam OutputIterator any output iterator (like
+       std::back_insert_iterator< std::vector<SCell> >).
+       @tparam TDomain the (hyper-rectangular) domain of the image.
+
+       @param out_it any output iterator for writing the signed cells.
+
+       @param aKSpace any space.
+       @param image a binary image, whose domain contains the bounds.
+
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+
+       @param nbThreads the number of threads (0 means as many as the
+       hardware supports).
+    */
+    template <typename OutputIterator, typename TDomain >
+    static
+    void sWriteBitBoundary( OutputIterator & out_it,
+                            const KSpace & aKSpace,
+                            const ImageContainerByBits<TDomain> & image,
+                            const Point & aLowerBound,
+                            const Point & aUpperBound,
+                            unsigned int nbThreads = 1 );
     
 
     
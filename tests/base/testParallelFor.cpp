@@ -0,0 +1,120 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ *
+ * @date 2026/10/16
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelFor.h"
+
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+TEST_CASE( "Testing chunkBounds" )
+{
+  auto b = functions::chunkBounds( 10, 3 );
+  REQUIRE( b.size() == 4 );
+  REQUIRE( b[ 0 ] == 0 );
+  REQUIRE( b[ 1 ] == 4 );
+  REQUIRE( b[ 2 ] == 7 );
+  REQUIRE( b[ 3 ] == 10 );
+  REQUIRE( functions::effectiveNbThreads( 0 ) >= 1 );
+  REQUIRE( functions::effectiveNbThreads( 3 ) == 3 );
+}
+
+TEST_CASE( "Testing parallelFor" )
+{
+  std::vector< std::size_t > v( 1000, 0 );
+  SECTION( "Every index is visited exactly once" )
+    {
+      functions::parallelFor( v.size(), 4,
+        [&v] ( unsigned int, std::size_t b, std::size_t e )
+        { for ( std::size_t i = b; i < e; ++i ) v[ i ] += i; } );
+      for ( std::size_t i = 0; i < v.size(); ++i )
+        REQUIRE( v[ i ] == i );
+    }
+  SECTION( "Exceptions are forwarded to the calling thread" )
+    {
+      REQUIRE_THROWS_AS( functions::parallelFor( v.size(), 4,
+        [] ( unsigned int c, std::size_t, std::size_t )
+        { if ( c == 2 ) throw std::runtime_error( "chunk 2" ); } ),
+                         std::runtime_error );
+    }
+}
+
+TEST_CASE( "Testing parallelForRange" )
+{
+  std::list< int > l( 101 );
+  std::iota( l.begin(), l.end(), 0 );
+  std::vector< int > sums( 8, 0 );
+  const unsigned int nb = functions::parallelForRange( l.begin(), l.end(), 8,
+    [&sums] ( unsigned int c, std::list<int>::iterator b, std::list<int>::iterator e )
+    { sums[ c ] = std::accumulate( b, e, 0 ); } );
+  REQUIRE( nb == 8 );
+  REQUIRE( std::accumulate( sums.begin(), sums.end(), 0 ) == 5050 );
+  REQUIRE( sums[ 0 ] == std::accumulate( l.begin(), std::next( l.begin(), 13 ), 0 ) );
+}
+
+TEST_CASE( "Testing parallelSum" )
+{
+  const auto f = [] ( std::size_t i ) -> double { return 1.0 / ( 1.0 + (double) i ); };
+  const std::size_t n = 100003;
+  double serial = 0.0;
+  for ( std::size_t k = 0; k < n; k += 1000 )
+    {
+      double block = 0.0;
+      for ( std::size_t i = k; i < std::min( n, k + 1000 ); ++i ) block += f( i );
+      serial += block;
+    }
+  REQUIRE( functions::parallelSum( n, 1, f, 1000 ) == serial );
+  REQUIRE( functions::parallelSum( n, 3, f, 1000 ) == serial );
+  REQUIRE( functions::parallelSum( n, 8, f, 1000 ) == serial );
+  REQUIRE( functions::parallelSum( 0, 4, f ) == 0.0 );
+}
+
+TEST_CASE( "Testing parallelSort" )
+{
+  std::vector< int > v( 100003 );
+  for ( std::size_t i = 0; i < v.size(); ++i )
+    v[ i ] = (int) ( ( i * 7919 ) % 1009 );
+  std::vector< int > w( v );
+  std::sort( w.begin(), w.end() );
+  SECTION( "Sorting with an odd number of chunks gives the sorted range" )
+    {
+      functions::parallelSort( v.begin(), v.end(), 5, std::less<int>(), 1000 );
+      REQUIRE( v == w );
+    }
+  SECTION( "Sorting with the default comparison gives the sorted range" )
+    {
+      functions::parallelSort( v.begin(), v.end(), 4 );
+      REQUIRE( v == w );
+    }
+}
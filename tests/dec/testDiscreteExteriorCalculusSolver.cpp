@@ -0,0 +1,124 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDiscreteExteriorCalculusSolver.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing the reuse of factorizations in class
+ * DiscreteExteriorCalculusSolver.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/dec/DiscreteExteriorCalculusSolver.h"
+#include "DGtal/dec/DECHelpers.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+using namespace Z2i;
+
+typedef DiscreteExteriorCalculus<2, 2, EigenLinearAlgebraBackend> Calculus;
+typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+
+/// @return the symmetric definite operator W + d0^t d0, where W is
+/// diagonal with weights depending on \a shift (as in AT problems).
+Calculus::PrimalIdentity0
+weightedOperator( const Calculus & calculus, const double shift )
+{
+  Calculus::PrimalForm0 weights( calculus );
+  for ( Calculus::Index i = 0; i < weights.length(); ++i )
+    weights.myContainer( i ) = shift + 0.1 * ( i % 7 );
+  const Calculus::PrimalDerivative0 d0 = calculus.derivative<0, PRIMAL>();
+  return dec_helper::diagonal( weights ) + d0.transpose() * d0;
+}
+
+TEST_CASE( "Testing DiscreteExteriorCalculusSolver factorization reuse" )
+{
+  DigitalSet set( Domain( Point( 0, 0 ), Point( 15, 12 ) ) );
+  for ( auto p : set.domain() )
+    if ( ( p - Point( 7, 6 ) ).norm() <= 5.5 ) set.insertNew( p );
+  const Calculus calculus = CalculusFactory::createFromDigitalSet( set );
+  Calculus::PrimalForm0 input( calculus );
+  for ( Calculus::Index i = 0; i < input.length(); ++i )
+    input.myContainer( i ) = 1.0 + ( i % 3 );
+
+  SECTION( "Direct solvers reuse the symbolic analysis" )
+    {
+      typedef DiscreteExteriorCalculusSolver<Calculus, EigenLinearAlgebraBackend::SolverSimplicialLDLT,
+                                             0, PRIMAL, 0, PRIMAL> Solver;
+      Solver solver;
+      solver.compute( weightedOperator( calculus, 1.0 ) );
+      REQUIRE( solver.isValid() );
+      REQUIRE( ! solver.isPatternReused() );
+      for ( double shift : { 2.0, 0.5, 4.0 } )
+        {
+          const Calculus::PrimalIdentity0 ope = weightedOperator( calculus, shift );
+          solver.compute( ope );
+          REQUIRE( solver.isValid() );
+          REQUIRE( solver.isPatternReused() );
+          Solver fresh;
+          fresh.compute( ope );
+          const Calculus::PrimalForm0 x = solver.solve( input );
+          const Calculus::PrimalForm0 y = fresh.solve( input );
+          REQUIRE( ( x.myContainer - y.myContainer ).norm() < 1e-10 );
+          REQUIRE( ( ope * x - input ).myContainer.norm() < 1e-8 );
+          // The guess is ignored by direct solvers.
+          const Calculus::PrimalForm0 z = solver.solve( input, input );
+          REQUIRE( ( x.myContainer - z.myContainer ).norm() < 1e-10 );
+        }
+      const Calculus::PrimalIdentity0 other = calculus.identity<0, PRIMAL>();
+      solver.compute( other );
+      REQUIRE( ! solver.isPatternReused() );
+      solver.forgetPattern();
+      solver.compute( other );
+      REQUIRE( ! solver.isPatternReused() );
+      REQUIRE( solver.isValid() );
+    }
+
+  SECTION( "Iterative solvers are warm-started" )
+    {
+      typedef DiscreteExteriorCalculusSolver<Calculus, EigenLinearAlgebraBackend::SolverConjugateGradient,
+                                             0, PRIMAL, 0, PRIMAL> Solver;
+      // Iterative solvers reference their operator, which must outlive them.
+      const Calculus::PrimalIdentity0 ope0 = weightedOperator( calculus, 1.0 );
+      const Calculus::PrimalIdentity0 ope1 = weightedOperator( calculus, 1.01 );
+      Solver solver;
+      solver.myLinearAlgebraSolver.setTolerance( 1e-12 );
+      solver.compute( ope0 );
+      const Calculus::PrimalForm0 x0 = solver.solve( input );
+      solver.compute( ope1 );
+      REQUIRE( solver.isPatternReused() );
+      const Calculus::PrimalForm0 cold = solver.solve( input );
+      const auto cold_iterations = solver.myLinearAlgebraSolver.iterations();
+      const Calculus::PrimalForm0 x1 = solver.solve( input, x0 );
+      REQUIRE( solver.isValid() );
+      REQUIRE( solver.myLinearAlgebraSolver.iterations() < cold_iterations );
+      REQUIRE( ( x1.myContainer - cold.myContainer ).norm() < 1e-8 );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
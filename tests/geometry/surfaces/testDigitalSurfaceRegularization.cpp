@@ -151,6 +151,32 @@ TEST_CASE( "Testing DigitalSurfaceRegularization" )
     REQUIRE( secondenergy > thirdenergy );
   }
   
+  SECTION("Several threads and conjugate gradient")
+  {
+    auto surface         = SH3::makeDigitalSurface( digitized_shape, K, params );
+    DigitalSurfaceRegularization<SH3::DigitalSurface> regul(surface);
+    regul.init();
+    regul.attachConvolvedTrivialNormalVectors(params);
+    DigitalSurfaceRegularization<SH3::DigitalSurface> regulPar(surface, ParallelExecutionPolicy(3));
+    regulPar.init();
+    regulPar.attachConvolvedTrivialNormalVectors(params);
+    REQUIRE( regul.computeGradient() == regulPar.computeGradient() );
+    auto energy    = regul.regularize(50,1.0,0.001);
+    auto energyPar = regulPar.regularize(50,1.0,0.001);
+    REQUIRE( energy == energyPar );
+    REQUIRE( regul.getRegularizedPositions() == regulPar.getRegularizedPositions() );
+
+    regul.reset();
+    regulPar.reset();
+    auto energyCG    = regul.regularizeConjugateGradient(50,1.0,0.001);
+    auto energyCGPar = regulPar.regularizeConjugateGradient(50,1.0,0.001);
+    CAPTURE( energy );
+    CAPTURE( energyCG );
+    REQUIRE( energyCG == energyCGPar );
+    REQUIRE( regul.getRegularizedPositions() == regulPar.getRegularizedPositions() );
+    REQUIRE( energyCG < energy );
+  }
+  
   SECTION("Local weights")
   {
     auto surface         = SH3::makeDigitalSurface( digitized_shape, K, params );
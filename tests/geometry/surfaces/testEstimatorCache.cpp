@@ -33,6 +33,7 @@
 #include "ConfigTest.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/surfaces/estimation/EstimatorCache.h"
+#include "DGtal/topology/CellHashMap.h"
 ///
 /// Shape
 #include "DGtal/shapes/implicit/ImplicitBall.h"
@@ -184,6 +185,28 @@ bool testEstimatorCache(double h)
   nb++;
   trace.info() << "(" << nbok << "/" << nb << ") "
 	       << "cache == eval" << std::endl;
+
+  trace.beginBlock( "Hashed cache populated by several threads ...");
+  typedef CellHashMap<Z3i::KSpace::SCell, MyIICurvatureEstimator::Quantity> HashContainer;
+  typedef EstimatorCache<MyIICurvatureEstimator, HashContainer> HashedGaussianCache;
+  BOOST_CONCEPT_ASSERT(( concepts::CSurfelLocalEstimator<HashedGaussianCache> ));
+  HashedGaussianCache hcache( curvatureEstimator );
+  hcache.init( h, surf.begin(), surf.end(), 4 );
+  trace.info() << "Number of cached values = "<< hcache.size()<<std::endl;
+  bool hok = hcache.size() == cache.size();
+  for(MyDigitalSurface::ConstIterator it = surf.begin(), itend=surf.end(); it != itend; ++it)
+    hok = hok && ( hcache.eval(it) == curvatureEstimator.eval(it) );
+  // The threaded init of a std::map cache is serial on insertion.
+  GaussianCache cache3( curvatureEstimator );
+  cache3.init( h, surf.begin(), surf.end(), 4 );
+  for(MyDigitalSurface::ConstIterator it = surf.begin(), itend=surf.end(); it != itend; ++it)
+    hok = hok && ( cache3.eval(it) == cache.eval(it) );
+  trace.endBlock();
+
+  nbok += hok ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "threaded hashed cache == eval" << std::endl;
   
   return nbok == nb;
 }
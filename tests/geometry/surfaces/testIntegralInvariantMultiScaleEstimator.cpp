@@ -0,0 +1,181 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class IntegralInvariantMultiScaleEstimator.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/helpers/ShortcutsGeometry.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantMultiScaleEstimator.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Shortcuts<Z3i::KSpace>         SH3;
+typedef ShortcutsGeometry<Z3i::KSpace> SHG3;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class IntegralInvariantMultiScaleEstimator.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing IntegralInvariantMultiScaleEstimator" )
+{
+  auto params = SH3::defaultParameters() | SHG3::defaultParameters() |  SHG3::parametersGeometryEstimation();
+  params( "polynomial", "goursat" )( "gridstep", 1. )( "verbose", 0 );
+  auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto binary_image    = SH3::makeBinaryImage( digitized_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto surface         = SH3::makeLightDigitalSurface( binary_image, K, params );
+  auto surfels         = SH3::getSurfelRange( surface, params );
+  const std::vector< double > radii = { 4.0, 2.0, 3.0 };
+
+  SECTION("Testing that multi-scale II mean curvatures match the single scale ones")
+  {
+    auto H = SHG3::getIIMeanCurvaturesMultiScale( binary_image, surfels, radii, params );
+    REQUIRE( H.size() == radii.size() );
+    for ( std::size_t j = 0; j < radii.size(); ++j )
+      {
+        auto Hj = SHG3::getIIMeanCurvatures( binary_image, surfels,
+                                             params( "r-radius", radii[ j ] ) );
+        REQUIRE( H[ j ].size() == Hj.size() );
+        unsigned int nb_ok = 0;
+        for ( std::size_t i = 0; i < Hj.size(); ++i )
+          nb_ok += H[ j ][ i ] == Hj[ i ] ? 1 : 0;
+        REQUIRE( nb_ok == Hj.size() );
+      }
+  }
+
+  SECTION("Testing that multi-scale II principal curvatures match the single scale ones")
+  {
+    auto T = SHG3::getIIPrincipalCurvaturesAndDirectionsMultiScale
+      ( binary_image, surfels, radii, params( "threads", 2 ) );
+    REQUIRE( T.size() == radii.size() );
+    for ( std::size_t j = 0; j < radii.size(); ++j )
+      {
+        auto Tj = SHG3::getIIPrincipalCurvaturesAndDirections
+          ( binary_image, surfels, params( "r-radius", radii[ j ] )( "threads", 1 ) );
+        REQUIRE( T[ j ].size() == Tj.size() );
+        unsigned int nb_ok = 0;
+        for ( std::size_t i = 0; i < Tj.size(); ++i )
+          nb_ok += ( std::get<0>( T[ j ][ i ] ) == std::get<0>( Tj[ i ] )
+                     && std::get<1>( T[ j ][ i ] ) == std::get<1>( Tj[ i ] ) ) ? 1 : 0;
+        REQUIRE( nb_ok == Tj.size() );
+      }
+  }
+
+  SECTION("Testing that predicate evaluations are shared between radii")
+  {
+    typedef functors::IIMeanCurvature3DFunctor<Z3i::Space> Functor;
+    typedef IntegralInvariantMultiScaleEstimator
+      < Z3i::KSpace, SH3::BinaryImage, Functor >           Estimator;
+    Estimator all;
+    all.attach( K, *binary_image );
+    all.setParams( radii );
+    all.init( 1.0, surfels.begin(), surfels.end() );
+    std::vector< Estimator::Quantity > H;
+    all.eval( surfels.begin(), surfels.end(), std::back_inserter( H ) );
+    REQUIRE( all.isValid() );
+    REQUIRE( H.size() == surfels.size() );
+    REQUIRE( all.radii()[ 0 ] == 2.0 );
+    std::size_t nb_separate = 0;
+    for ( auto r : radii )
+      {
+        Estimator one;
+        one.attach( K, *binary_image );
+        one.setParams( { r } );
+        one.init( 1.0, surfels.begin(), surfels.end() );
+        std::vector< Estimator::Quantity > Hr;
+        one.eval( surfels.begin(), surfels.end(), std::back_inserter( Hr ) );
+        nb_separate += one.nbPredicateEvaluations();
+      }
+    trace.info() << "#evaluations multi-scale=" << all.nbPredicateEvaluations()
+                 << " separate=" << nb_separate << std::endl;
+    REQUIRE( all.nbPredicateEvaluations() < nb_separate );
+
+    // Threaded evaluations count the same predicate evaluations.
+    Estimator threaded;
+    threaded.attach( K, *binary_image );
+    threaded.setParams( radii );
+    threaded.init( 1.0, surfels.begin(), surfels.end() );
+    std::vector< Estimator::Quantity > Ht;
+    threaded.eval( surfels.begin(), surfels.end(), std::back_inserter( Ht ), 3 );
+    REQUIRE( Ht == H );
+    REQUIRE( threaded.nbPredicateEvaluations() > 0 );
+    REQUIRE( threaded.nbPredicateEvaluations() >= all.nbPredicateEvaluations() );
+  }
+
+  SECTION("Testing that no radii or more than 64 radii are rejected")
+  {
+    typedef functors::IIMeanCurvature3DFunctor<Z3i::Space> Functor;
+    typedef IntegralInvariantMultiScaleEstimator
+      < Z3i::KSpace, SH3::BinaryImage, Functor >           Estimator;
+    Estimator estimator;
+    REQUIRE_THROWS_AS( estimator.setParams( {} ), std::invalid_argument );
+    REQUIRE_THROWS_AS( estimator.setParams( std::vector< double >( 65, 3.0 ) ),
+                       std::invalid_argument );
+    REQUIRE_NOTHROW( estimator.setParams( std::vector< double >( 64, 3.0 ) ) );
+    REQUIRE( estimator.radii().size() == 64 );
+  }
+
+  SECTION("Testing the k-fold reduction of predicate evaluations on full kernels")
+  {
+    // With nearly equal radii, the k kernels are almost the same, so
+    // that full kernel evaluations are shared k times (the merged
+    // shifting masks of the outer spels are a bit larger).
+    typedef functors::IIMeanCurvature3DFunctor<Z3i::Space> Functor;
+    typedef IntegralInvariantMultiScaleEstimator
+      < Z3i::KSpace, SH3::BinaryImage, Functor >           Estimator;
+    const std::vector< double > close_radii = { 5.0, 5.05, 5.1 };
+    // One surfel at a time: every inner spel is a full kernel evaluation.
+    auto evalOneByOne = [&] ( const std::vector< double >& r ) -> std::size_t
+      {
+        Estimator estimator;
+        estimator.attach( K, *binary_image );
+        estimator.setParams( r );
+        estimator.init( 1.0, surfels.begin(), surfels.end() );
+        for ( auto it = surfels.begin(); it != surfels.end(); ++it )
+          estimator.eval( it );
+        return estimator.nbPredicateEvaluations();
+      };
+    const std::size_t nb_all = evalOneByOne( close_radii );
+    std::size_t nb_separate  = 0;
+    for ( auto r : close_radii ) nb_separate += evalOneByOne( { r } );
+    trace.info() << "#evaluations multi-scale=" << nb_all
+                 << " separate=" << nb_separate << std::endl;
+    REQUIRE( (double) nb_separate >= 0.8 * close_radii.size() * (double) nb_all );
+  }
+}
+
+/** @ingroup Tests **/
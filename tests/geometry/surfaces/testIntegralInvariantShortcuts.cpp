@@ -86,4 +86,48 @@ TEST_CASE( "Testing IntegralInvariant Shortcuts API" )
   }
 }
 
+TEST_CASE( "Testing multi-threaded IntegralInvariant Shortcuts" )
+{
+  auto params = SH3::defaultParameters() | SHG3::defaultParameters() |  SHG3::parametersGeometryEstimation();
+  params( "polynomial", "goursat" )( "gridstep", 1. )( "verbose", 0 );
+  auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto binary_image    = SH3::makeBinaryImage( digitized_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto surface         = SH3::makeLightDigitalSurface( binary_image, K, params );
+  auto surfels         = SH3::getSurfelRange( surface, params );
+  params( "r-radius", 3.0 );
+
+  auto H1 = SHG3::getIIMeanCurvatures( binary_image, surfels, params( "threads", 1 ) );
+  auto T1 = SHG3::getIIPrincipalCurvaturesAndDirections( binary_image, surfels, params );
+  auto H4 = SHG3::getIIMeanCurvatures( binary_image, surfels, params( "threads", 4 ) );
+  auto T4 = SHG3::getIIPrincipalCurvaturesAndDirections( binary_image, surfels, params );
+
+  SECTION("Testing that parallel II estimations match the serial ones")
+  {
+    REQUIRE( H4.size() == H1.size() );
+    REQUIRE( T4.size() == T1.size() );
+    unsigned int nb_ok_H = 0;
+    unsigned int nb_ok_T = 0;
+    for ( std::size_t i = 0; i < H1.size(); ++i )
+      {
+        nb_ok_H += H4[ i ] == H1[ i ] ? 1 : 0;
+        nb_ok_T += ( std::get<0>( T4[ i ] ) == std::get<0>( T1[ i ] )
+                     && std::get<1>( T4[ i ] ) == std::get<1>( T1[ i ] ) ) ? 1 : 0;
+      }
+    REQUIRE( nb_ok_H == H1.size() );
+    REQUIRE( nb_ok_T == T1.size() );
+  }
+
+  SECTION("Testing that summed volume table II mean curvatures match the moving kernel ones")
+  {
+    auto Hs = SHG3::getIIMeanCurvatures( binary_image, surfels, params( "ii-kernel", "svt" ) );
+    REQUIRE( Hs.size() == H1.size() );
+    unsigned int nb_ok = 0;
+    for ( std::size_t i = 0; i < H1.size(); ++i )
+      nb_ok += Hs[ i ] == H1[ i ] ? 1 : 0;
+    REQUIRE( nb_ok == H1.size() );
+  }
+}
+
 /** @ingroup Tests **/
@@ -261,13 +261,79 @@ bool testMeanCurvature3d( double h, double delta )
   return true;
 }
 
+bool testSummedVolumeTableStrategy3d( double h )
+{
+  typedef ImplicitBall<Z3i::Space> ImplicitShape;
+  typedef GaussDigitizer<Z3i::Space, ImplicitShape> DigitalShape;
+  typedef LightImplicitDigitalSurface<Z3i::KSpace,DigitalShape> Boundary;
+  typedef DigitalSurface< Boundary > MyDigitalSurface;
+  typedef DepthFirstVisitor< MyDigitalSurface > Visitor;
+  typedef GraphVisitorRange< Visitor > VisitorRange;
+  typedef VisitorRange::ConstIterator VisitorConstIterator;
+
+  typedef functors::IIMeanCurvature3DFunctor<Z3i::Space> MyIICurvatureFunctor;
+  typedef IntegralInvariantVolumeEstimator< Z3i::KSpace, DigitalShape, MyIICurvatureFunctor > MyIICurvatureEstimator;
+  typedef MyIICurvatureFunctor::Value Value;
+
+  trace.beginBlock( "Comparing moving kernel and summed volume table strategies ..." );
+
+  ImplicitShape ishape( Z3i::RealPoint( 0, 0, 0 ), 5 );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( Z3i::RealPoint( -10.0, -10.0, -10.0 ), Z3i::RealPoint( 10.0, 10.0, 10.0 ), h );
+
+  Z3i::KSpace K;
+  if ( !K.init( dshape.getLowerBound(), dshape.getUpperBound(), true ) )
+  {
+    trace.error() << "Problem with Khalimsky space" << std::endl;
+    trace.endBlock();
+    return false;
+  }
+
+  Z3i::KSpace::Surfel bel = Surfaces<Z3i::KSpace>::findABel( K, dshape, 10000 );
+  Boundary boundary( K, dshape, SurfelAdjacency<Z3i::KSpace::dimension>( true ), bel );
+  MyDigitalSurface surf ( boundary );
+  VisitorRange range( new Visitor( surf, *surf.begin() ));
+  std::vector< Z3i::KSpace::Surfel > surfels( range.begin(), range.end() );
+
+  bool ok = true;
+  // Several radii (the last one bigger than the shape), the summed
+  // volume table being shared by all of them.
+  MyIICurvatureEstimator svtEstimator;
+  svtEstimator.attach( K, dshape );
+  svtEstimator.setKernelStrategy( MyIICurvatureEstimator::SUMMED_VOLUME_TABLE );
+  for ( double re : { 2.0, 3.5, 7.0 } )
+  {
+    MyIICurvatureEstimator movingEstimator;
+    movingEstimator.attach( K, dshape );
+    movingEstimator.setParams( re/h );
+    movingEstimator.init( h, surfels.begin(), surfels.end() );
+    svtEstimator.setParams( re/h );
+    svtEstimator.init( h, surfels.begin(), surfels.end() );
+
+    std::vector< Value > moving, svt;
+    movingEstimator.eval( surfels.begin(), surfels.end(), std::back_inserter( moving ) );
+    svtEstimator.eval( surfels.begin(), surfels.end(), std::back_inserter( svt ) );
+    unsigned int nbDiff = 0;
+    for ( std::size_t i = 0; i < moving.size(); ++i )
+      nbDiff += ( moving[ i ] != svt[ i ] ) ? 1 : 0;
+    nbDiff += ( svtEstimator.eval( surfels.begin() ) != moving[ 0 ] ) ? 1 : 0;
+    trace.info() << "r=" << re << " #surfels=" << moving.size()
+                 << " #differences=" << nbDiff << std::endl;
+    ok = ok && ( moving.size() == svt.size() ) && ( nbDiff == 0 );
+  }
+  trace.endBlock();
+  return ok;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
 int main( int /*argc*/, char** /*argv*/ )
 {
   trace.beginBlock ( "Testing class IntegralInvariantVolumeEstimator and 2d/3d mean curvature functors" );
-    bool res = testCurvature2d( 0.05, 0.002 ) && testMeanCurvature3d( 0.6, 0.008 );
+    bool res = testCurvature2d( 0.05, 0.002 ) && testMeanCurvature3d( 0.6, 0.008 )
+      && testSummedVolumeTableStrategy3d( 0.5 );
     trace.emphase() << ( res ? "Passed." : "Error." ) << std::endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -111,4 +111,18 @@ TEST_CASE( "Testing ShroudsRegularization" )
   //! [ShroudsRegSnake]
 
   REQUIRE( energyRegSnk < energyInitSnk );
+
+  // Several threads give the same optimization.
+  ShroudsRegularization< Container > shrouds_ser( idxsurface );
+  ShroudsRegularization< Container > shrouds_par( idxsurface, ParallelExecutionPolicy( 3 ) );
+  for ( auto reg : { RegType::SQUARED_CURVATURE, RegType::SNAKE, RegType::AREA } )
+    {
+      srand( 0 );
+      auto resSer = shrouds_ser.regularize( reg, 0.5, 0.0001, 20 );
+      srand( 0 );
+      auto resPar = shrouds_par.regularize( reg, 0.5, 0.0001, 20 );
+      REQUIRE( resSer == resPar );
+      REQUIRE( shrouds_ser.energy( reg ) == shrouds_par.energy( reg ) );
+      REQUIRE( shrouds_ser.positions() == shrouds_par.positions() );
+    }
 }
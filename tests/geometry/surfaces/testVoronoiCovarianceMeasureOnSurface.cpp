@@ -120,6 +120,28 @@ bool testVoronoiCovarianceMeasureOnSurface()
                                                           10.0, 5.0, chi, 1.5, Metric(), true ) );
   trace.endBlock();
 
+  trace.beginBlock("Computing VCM on surface with 4 threads." );
+  VCMOnSurface vcm_surface_par( ptrSurface, Pointels, 10.0, 5.0, chi, 1.5, Metric(), false,
+                                ParallelExecutionPolicy( 4 ) );
+  double max_diff = 0.0;
+  for ( ConstIterator it = ptrSurface->begin(), itE = ptrSurface->end(); it != itE; ++it )
+    {
+      const VCMOnSurface::Normals & n1 = vcm_surface->mapSurfel2Normals().find( *it )->second;
+      const VCMOnSurface::Normals & n2 = vcm_surface_par.mapSurfel2Normals().find( *it )->second;
+      max_diff = std::max( max_diff, ( n1.vcmNormal - n2.vcmNormal ).norm() );
+      max_diff = std::max( max_diff, ( n1.trivialNormal - n2.trivialNormal ).norm() );
+    }
+  nbok += ( vcm_surface_par.mapSurfel2Normals().size()
+            == vcm_surface->mapSurfel2Normals().size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "the parallel VCM has as many normals as the serial one" << std::endl;
+  nbok += ( max_diff < 1e-12 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "parallel and serial normals are the same: " << max_diff << std::endl;
+  trace.endBlock();
+
   trace.beginBlock("Wrapping normal estimator." );
   typedef functors::VCMNormalVectorFunctor<VCMOnSurface> NormalVectorFunctor;
   typedef VCMDigitalSurfaceLocalEstimator<SurfaceContainer,Metric,
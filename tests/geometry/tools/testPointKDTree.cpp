@@ -0,0 +1,188 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPointKDTree.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class PointKDTree.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/tools/PointKDTree.h"
+#include "DGtal/geometry/tools/CPointProximityStructure.h"
+#include "DGtal/geometry/volumes/estimation/VoronoiCovarianceMeasure.h"
+#include "DGtal/kernel/Point2ScalarFunctors.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace DGtal::Z3i;
+
+typedef PointKDTree< Space > KDTree;
+
+/// @return points with a very non-uniform density: a dense blob and sparse outliers.
+std::vector< Point > makePoints()
+{
+  std::mt19937 gen( 17 );
+  std::normal_distribution< double > blob( 0.0, 3.0 );
+  std::uniform_int_distribution< int > far( -60, 60 );
+  std::vector< Point > pts;
+  for ( int i = 0; i < 3000; ++i )
+    pts.push_back( Point( (int) std::round( blob( gen ) ),
+                          (int) std::round( blob( gen ) ),
+                          (int) std::round( blob( gen ) ) ) );
+  for ( int i = 0; i < 200; ++i )
+    pts.push_back( Point( far( gen ), far( gen ), far( gen ) ) );
+  return pts;
+}
+
+/// @return the indices of the points of \a pts in [lo,up], by brute force.
+std::vector< KDTree::Size > bruteForce( const std::vector< Point > & pts,
+                                        const Point & lo, const Point & up )
+{
+  std::vector< KDTree::Size > indices;
+  for ( KDTree::Size i = 0; i < pts.size(); ++i )
+    if ( lo.inf( pts[ i ] ) == lo && up.sup( pts[ i ] ) == up ) indices.push_back( i );
+  return indices;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PointKDTree.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing PointKDTree" )
+{
+  BOOST_CONCEPT_ASSERT(( concepts::CPointProximityStructure< KDTree > ));
+  const std::vector< Point > pts = makePoints();
+  KDTree tree( pts.begin(), pts.end(), 8 );
+  REQUIRE( tree.isValid() );
+  REQUIRE( tree.size() == pts.size() );
+  for ( KDTree::Size i = 0; i < pts.size(); ++i )
+    REQUIRE( tree.point( i ) == pts[ i ] );
+  for ( const auto & node : tree.nodes() )
+    if ( node.child == 0 ) REQUIRE( node.end - node.begin <= tree.leafSize() );
+
+  SECTION( "Box queries give the same points as brute force" )
+    {
+      std::vector< Point > centers = { Point( 0, 0, 0 ), Point( 2, -1, 3 ), Point( 40, 40, 40 ),
+                                       Point( -60, 0, 60 ), Point( 100, 100, 100 ) };
+      for ( KDTree::Size i = 0; i < pts.size(); i += 97 ) centers.push_back( pts[ i ] );
+      for ( const Point & c : centers )
+        for ( int r : { 0, 1, 3, 10 } )
+          {
+            const Point lo = c - Point::diagonal( r );
+            const Point up = c + Point::diagonal( r );
+            std::vector< KDTree::Size > indices;
+            tree.getIndicesInBox( indices, lo, up );
+            std::sort( indices.begin(), indices.end() );
+            REQUIRE( indices == bruteForce( pts, lo, up ) );
+          }
+      std::vector< std::vector< KDTree::Size > > batch;
+      tree.getIndicesInBoxes( batch, centers, 3 );
+      REQUIRE( batch.size() == centers.size() );
+      for ( KDTree::Size i = 0; i < centers.size(); ++i )
+        {
+          std::sort( batch[ i ].begin(), batch[ i ].end() );
+          REQUIRE( batch[ i ] == bruteForce( pts, centers[ i ] - Point::diagonal( 3 ),
+                                             centers[ i ] + Point::diagonal( 3 ) ) );
+        }
+    }
+
+  SECTION( "Empty and degenerate trees" )
+    {
+      KDTree empty;
+      std::vector< KDTree::Size > indices;
+      empty.getIndicesInBox( indices, Point::diagonal( -5 ), Point::diagonal( 5 ) );
+      REQUIRE( indices.empty() );
+      std::vector< Point > same( 100, Point( 1, 2, 3 ) );
+      KDTree tree_same( same.begin(), same.end(), 4 );
+      tree_same.getIndicesInBox( indices, Point( 1, 2, 3 ), Point( 1, 2, 3 ) );
+      REQUIRE( indices.size() == 100 );
+    }
+}
+
+TEST_CASE( "Testing VoronoiCovarianceMeasure with PointKDTree" )
+{
+  typedef VoronoiCovarianceMeasure< Space, L2Metric > VCM;
+  typedef VCM::MatrixNN                              Matrix;
+  typedef functors::HatPointFunction< Point, double > KernelFunction;
+  std::vector< Point > pts;
+  for ( auto p : Domain( Point( -8, -8, -8 ), Point( 8, 8, 8 ) ) )
+    if ( std::abs( p.norm() - 6.0 ) <= 0.5 ) pts.push_back( p );
+  pts.push_back( pts.front() ); // duplicated point
+  VCM vcm( 4.0, 3.0, l2Metric, false );
+  vcm.init( pts.begin(), pts.end() );
+  REQUIRE( vcm.points().size() == pts.size() - 1 );
+  REQUIRE( vcm.vcmVector().size() == vcm.points().size() );
+  REQUIRE( std::is_sorted( vcm.points().begin(), vcm.points().end() ) );
+  REQUIRE( vcm.vcmMap().size() == vcm.points().size() );
+  REQUIRE( vcm.index( vcm.points()[ 5 ] ) == 5 );
+  REQUIRE( vcm.index( Point( 100, 0, 0 ) ) == vcm.points().size() );
+
+  KernelFunction chi( 1.0, 3.0 );
+  std::vector< Matrix > batch;
+  vcm.measure( chi, vcm.points().begin(), vcm.points().end(), std::back_inserter( batch ) );
+  REQUIRE( batch.size() == vcm.points().size() );
+  double max_error = 0.0;
+  for ( std::size_t i = 0; i < vcm.points().size(); i += 7 )
+    {
+      const Point p = vcm.points()[ i ];
+      // Brute-force integration over all the points.
+      Matrix expected;
+      for ( std::size_t j = 0; j < vcm.points().size(); ++j )
+        {
+          const double coef = chi( vcm.points()[ j ] - p );
+          if ( coef > 0.0 )
+            {
+              Matrix m = vcm.vcmVector()[ j ];
+              m *= coef;
+              expected += m;
+            }
+        }
+      const Matrix single = vcm.measure( chi, p );
+      for ( Dimension r = 0; r < 3; ++r )
+        for ( Dimension c = 0; c < 3; ++c )
+          {
+            max_error = std::max( max_error, std::abs( single( r, c ) - expected( r, c ) ) );
+            max_error = std::max( max_error, std::abs( batch[ i ]( r, c ) - expected( r, c ) ) );
+          }
+    }
+  REQUIRE( max_error < 1e-8 );
+
+  // Sharded accumulation and split batched queries give the same measures.
+  VCM vcm_par( 4.0, 3.0, l2Metric, false, ParallelExecutionPolicy( 3 ) );
+  vcm_par.init( pts.begin(), pts.end() );
+  REQUIRE( vcm_par.points() == vcm.points() );
+  REQUIRE( vcm_par.vcmVector() == vcm.vcmVector() );
+  std::vector< Matrix > batch_par;
+  vcm_par.measure( chi, vcm.points().begin(), vcm.points().end(), std::back_inserter( batch_par ) );
+  REQUIRE( batch_par == batch );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
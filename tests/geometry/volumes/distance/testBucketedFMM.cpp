@@ -0,0 +1,237 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBucketedFMM.cpp
+ * @ingroup Tests
+ * @date 2026/10/16
+ *
+ * @brief Functions for testing class BucketedFMM against FMM.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/DigitalSetFromMap.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/geometry/volumes/distance/FMM.h"
+#include "DGtal/geometry/volumes/distance/BucketedFMM.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class BucketedFMM.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef Z3i::Domain                                Domain;
+typedef Z3i::Point                                 Point;
+typedef Domain::Predicate                          Predicate;
+typedef ImageContainerBySTLMap<Domain,double>      Image;
+typedef DigitalSetFromMap<Image>                   Set;
+typedef FMM<Image, Set, Predicate>                 ReferenceFMM;
+typedef BucketedFMM<Z3i::Space, Predicate>         FastMarching;
+typedef std::vector< std::pair<Point,Point> >      Pairs;
+
+/**
+ * Pairs of 6-adjacent points (inside, outside) of the digital ball of
+ * radius @a radius centered at the origin.
+ */
+Pairs ballBoundary( const Domain & domain, double radius )
+{
+  Pairs pairs;
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      const Point p = *it;
+      if ( p.norm() > radius ) continue;
+      for ( Dimension k = 0; k < 3; ++k )
+        for ( int side = -1; side <= 1; side += 2 )
+          {
+            Point q = p;
+            q[ k ] += side;
+            if ( domain.isInside( q ) && q.norm() > radius )
+              pairs.push_back( std::make_pair( p, q ) );
+          }
+    }
+  return pairs;
+}
+
+/**
+ * Compares the accepted values of @a fmm to the ones of @a map.
+ * @return the maximal absolute difference on the points accepted by
+ * both, and the number of points accepted by only one of them.
+ */
+std::pair<double,unsigned int> compare( const FastMarching & fmm,
+                                        const Image & map, const Set & set )
+{
+  double       diff    = 0.0;
+  unsigned int missing = 0;
+  for ( Domain::ConstIterator it = fmm.domain().begin(); it != fmm.domain().end(); ++it )
+    {
+      const bool inSet = set.find( *it ) != set.end();
+      if ( inSet != fmm.isAccepted( *it ) ) ++missing;
+      else if ( inSet ) diff = std::max( diff, std::abs( fmm( *it ) - map( *it ) ) );
+    }
+  return std::make_pair( diff, missing );
+}
+
+/**
+ * Signed distance to a ball, within a narrow band: the bucketed queue
+ * is compared to FMM.
+ */
+bool testBucketedQueue()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Bucketed queue versus FMM..." );
+  const Domain domain( Point::diagonal( -12 ), Point::diagonal( 12 ) );
+  const Pairs  pairs = ballBoundary( domain, 7.3 );
+  const double band  = 4.0;
+
+  Image map( domain, 0.0 );
+  Set   set( map );
+  ReferenceFMM::initFromIncidentPointsRange( pairs.begin(), pairs.end(), map, set, 0.5 );
+  ReferenceFMM reference( map, set, domain.predicate(),
+                          std::numeric_limits<DGtal::uint64_t>::max(), band );
+  reference.compute();
+  trace.info() << reference << std::endl;
+
+  // Nearly tidy queue: same values.
+  {
+    FastMarching fmm( domain, domain.predicate(),
+                      std::numeric_limits<DGtal::uint64_t>::max(), band, 1e-6 );
+    fmm.initFromIncidentPointsRange( pairs.begin(), pairs.end(), 0.5 );
+    fmm.compute();
+    trace.info() << fmm << std::endl;
+    const std::pair<double,unsigned int> res = compare( fmm, map, set );
+    trace.info() << "max diff=" << res.first << " #missing=" << res.second << std::endl;
+    nbok += ( res.first < 1e-9 && res.second == 0 ) ? 1 : 0;
+    nb++;
+    nbok += ( fmm.nbAccepted() == set.size()
+              && std::abs( fmm.min() - reference.min() ) < 1e-9
+              && std::abs( fmm.max() - reference.max() ) < 1e-9 && fmm.isValid() ) ? 1 : 0;
+    nb++;
+  }
+
+  // Default (untidy) queue: values within the bucket width.
+  {
+    FastMarching fmm( domain, domain.predicate(),
+                      std::numeric_limits<DGtal::uint64_t>::max(), band );
+    fmm.initFromIncidentPointsRange( pairs.begin(), pairs.end(), 0.5 );
+    fmm.compute();
+    trace.info() << fmm << std::endl;
+    const std::pair<double,unsigned int> res = compare( fmm, map, set );
+    trace.info() << "max diff=" << res.first << " #missing=" << res.second << std::endl;
+    nbok += ( res.first <= fmm.bucketWidth() && res.second <= set.size() / 100 ) ? 1 : 0;
+    nb++;
+  }
+
+  // Area threshold.
+  {
+    const DGtal::uint64_t area = 2 * pairs.size() + 100;
+    FastMarching fmm( domain, domain.predicate(), area );
+    fmm.initFromIncidentPointsRange( pairs.begin(), pairs.end(), 0.5 );
+    fmm.compute();
+    trace.info() << fmm << std::endl;
+    nbok += ( fmm.nbAccepted() + 1 == area ) ? 1 : 0;
+    nb++;
+  }
+
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Fast sweeping is compared to FMM, and does not depend on the number
+ * of threads.
+ */
+bool testSweeping()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Fast sweeping versus FMM..." );
+  const Domain domain( Point( -10, -9, -13 ), Point( 11, 9, 12 ) );
+  const Pairs  pairs = ballBoundary( domain, 6.5 );
+  const double band  = 5.0;
+
+  Image map( domain, 0.0 );
+  Set   set( map );
+  ReferenceFMM::initFromIncidentPointsRange( pairs.begin(), pairs.end(), map, set, 0.5 );
+  ReferenceFMM reference( map, set, domain.predicate(),
+                          std::numeric_limits<DGtal::uint64_t>::max(), band );
+  reference.compute();
+
+  FastMarching serial( domain, domain.predicate(),
+                       std::numeric_limits<DGtal::uint64_t>::max(), band );
+  serial.initFromIncidentPointsRange( pairs.begin(), pairs.end(), 0.5 );
+  const Domain::Size nbIt = serial.computeBySweeping( ParallelExecutionPolicy( 1 ), 4 );
+  trace.info() << serial << " in " << nbIt << " iterations" << std::endl;
+  const std::pair<double,unsigned int> res = compare( serial, map, set );
+  trace.info() << "max diff=" << res.first << " #missing=" << res.second << std::endl;
+  nbok += ( res.first < 1e-9 && res.second == 0 ) ? 1 : 0;
+  nb++;
+
+  FastMarching parallel( domain, domain.predicate(),
+                         std::numeric_limits<DGtal::uint64_t>::max(), band );
+  parallel.initFromIncidentPointsRange( pairs.begin(), pairs.end(), 0.5 );
+  parallel.computeBySweeping( ParallelExecutionPolicy( 4 ), 4 );
+  bool same = parallel.nbAccepted() == serial.nbAccepted();
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    same = same && ( parallel( *it ) == serial( *it ) );
+  nbok += same ? 1 : 0;
+  nb++;
+
+  // Copy into the image and set of a FMM.
+  Image copy( domain, 0.0 );
+  Set   copySet( copy );
+  parallel.copyTo( copy, copySet );
+  const std::pair<double,unsigned int> resCopy = compare( parallel, copy, copySet );
+  nbok += ( resCopy.first == 0.0 && resCopy.second == 0 ) ? 1 : 0;
+  nb++;
+
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class BucketedFMM" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testBucketedQueue() && testSweeping();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,123 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFMM-benchmark.cpp
+ * @ingroup Tests
+ * @date 2026/10/16
+ *
+ * Benchmark of FMM versus BucketedFMM (marching and fast sweeping) on
+ * the narrow band of a ball.
+ *
+ * Usage: testFMM-benchmark [size=512] [band=3] [threads=0]
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/DigitalSetFromMap.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/geometry/volumes/distance/FMM.h"
+#include "DGtal/geometry/volumes/distance/BucketedFMM.h"
+#include <boost/lexical_cast.hpp>
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class BucketedFMM.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef Z3i::Domain                                Domain;
+typedef Z3i::Point                                 Point;
+typedef Domain::Predicate                          Predicate;
+typedef ImageContainerBySTLMap<Domain,double>      Image;
+typedef DigitalSetFromMap<Image>                   Set;
+typedef std::vector< std::pair<Point,Point> >      Pairs;
+
+int main( int argc, char** argv )
+{
+  const int          size    = argc > 1 ? boost::lexical_cast<int>( argv[ 1 ] ) : 512;
+  const double       band    = argc > 2 ? boost::lexical_cast<double>( argv[ 2 ] ) : 3.0;
+  const unsigned int threads = argc > 3 ? boost::lexical_cast<unsigned int>( argv[ 3 ] ) : 0;
+
+  const Domain domain( Point::diagonal( 0 ), Point::diagonal( size - 1 ) );
+  const Point  center = Point::diagonal( size / 2 );
+  const DGtal::int64_t r2 = (DGtal::int64_t) ( size / 3 ) * ( size / 3 );
+  const auto inside = [&] ( const Point & p )
+    {
+      const Point v = p - center;
+      return (DGtal::int64_t) v[0]*v[0] + (DGtal::int64_t) v[1]*v[1]
+        + (DGtal::int64_t) v[2]*v[2] <= r2;
+    };
+
+  trace.beginBlock( "Ball boundary" );
+  Pairs pairs;
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( inside( *it ) )
+      for ( Dimension k = 0; k < 3; ++k )
+        for ( int side = -1; side <= 1; side += 2 )
+          {
+            Point q = *it;
+            q[ k ] += side;
+            if ( ! inside( q ) ) pairs.push_back( std::make_pair( *it, q ) );
+          }
+  trace.info() << size << "^3 domain, " << pairs.size() << " pairs, band " << band << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock( "FMM (std::set queue, map storage)" );
+  {
+    Image map( domain, 0.0 );
+    Set   set( map );
+    FMM<Image, Set, Predicate>::initFromIncidentPointsRange
+      ( pairs.begin(), pairs.end(), map, set, 0.5 );
+    FMM<Image, Set, Predicate> fmm( map, set, domain.predicate(),
+                                    std::numeric_limits<DGtal::uint64_t>::max(), band );
+    fmm.compute();
+    trace.info() << fmm << std::endl;
+  }
+  trace.endBlock();
+
+  trace.beginBlock( "BucketedFMM::compute" );
+  {
+    BucketedFMM<Z3i::Space, Predicate> fmm( domain, domain.predicate(),
+                                            std::numeric_limits<DGtal::uint64_t>::max(), band );
+    fmm.initFromIncidentPointsRange( pairs.begin(), pairs.end(), 0.5 );
+    fmm.compute();
+    trace.info() << fmm << std::endl;
+  }
+  trace.endBlock();
+
+  trace.beginBlock( "BucketedFMM::computeBySweeping" );
+  {
+    BucketedFMM<Z3i::Space, Predicate> fmm( domain, domain.predicate(),
+                                            std::numeric_limits<DGtal::uint64_t>::max(), band );
+    fmm.initFromIncidentPointsRange( pairs.begin(), pairs.end(), 0.5 );
+    const Domain::Size nbIt = fmm.computeBySweeping( ParallelExecutionPolicy( threads ), 16 );
+    trace.info() << fmm << " in " << nbIt << " iterations" << std::endl;
+  }
+  trace.endBlock();
+
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
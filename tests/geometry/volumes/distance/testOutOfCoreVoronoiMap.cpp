@@ -0,0 +1,173 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testOutOfCoreVoronoiMap.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class OutOfCoreVoronoiMap.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <array>
+#include <algorithm>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageFactoryFromImage.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+#include "DGtal/geometry/volumes/distance/OutOfCoreVoronoiMap.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class OutOfCoreVoronoiMap.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * An image factory that records the largest requested image.
+ */
+template <typename TImage>
+struct RecordingFactory : public ImageFactoryFromImage<TImage>
+{
+  typedef ImageFactoryFromImage<TImage>     Parent;
+  typedef typename Parent::Domain           Domain;
+  typedef typename Parent::OutputImage      OutputImage;
+
+  RecordingFactory( Alias<TImage> anImage )
+    : Parent( anImage ), maxSize( 0 ) {}
+
+  OutputImage * requestImage( const Domain & aDomain )
+  {
+    maxSize = std::max( maxSize, (std::size_t) aDomain.size() );
+    return Parent::requestImage( aDomain );
+  }
+
+  std::size_t maxSize;
+};
+
+/**
+ * Compares the out-of-core map with the in-memory one.
+ */
+template <typename TDomain, typename TSet>
+bool checkOutOfCore( const TDomain & domain, const TSet & sites,
+                     typename TDomain::Size maxSlabSize,
+                     std::array<bool, TDomain::Space::dimension> const & periodicity,
+                     ParallelExecutionPolicy const & policy = ParallelExecutionPolicy() )
+{
+  typedef typename TDomain::Space                                     Space;
+  typedef ExactPredicateLpSeparableMetric<Space, 2>                   Metric;
+  typedef functors::NotPointPredicate<TSet>                           Predicate;
+  typedef ImageContainerBySTLVector<TDomain, typename Space::Vector>  Image;
+  typedef RecordingFactory<Image>                                     Factory;
+  typedef DistanceTransformation<Space, Predicate, Metric>            DT;
+  typedef OutOfCoreVoronoiMap<Space, Predicate, Metric, Factory>      Voronoi;
+
+  Metric    metric;
+  Predicate predicate( sites );
+  Image     image( domain );
+  Factory   factory( image );
+  DT        dt( domain, predicate, metric, periodicity );
+  Voronoi   voronoi( domain, predicate, metric, factory, maxSlabSize, periodicity, policy );
+
+  unsigned int nbok = 0;
+  for ( auto const & p : domain )
+    nbok += ( dt.getVoronoiVector( p ) == image( p )
+              && dt( p ) == voronoi.distance( p, image( p ) ) ) ? 1 : 0;
+  trace.info() << voronoi << " max requested size=" << factory.maxSize
+               << " (" << nbok << "/" << domain.size() << ")" << std::endl;
+  // Slabs are at least one point thick. They are cut along the last
+  // dimension, then along the previous one for the last pass.
+  const auto extent = domain.upperBound() - domain.lowerBound() + TDomain::Point::diagonal( 1 );
+  const auto last   = TDomain::Space::dimension - 1;
+  const std::size_t layer = std::max( domain.size() / extent[ last ],
+                                      domain.size() / extent[ last >= 1 ? last - 1 : 0 ] );
+  return nbok == domain.size() && voronoi.isValid()
+    && factory.maxSize <= std::max( (std::size_t) maxSlabSize, layer );
+}
+
+bool testOutOfCoreVoronoiMap3D()
+{
+  trace.beginBlock( "Testing OutOfCoreVoronoiMap in 3D" );
+  Z3i::Domain     domain( Z3i::Point( -3, 0, 2 ), Z3i::Point( 16, 12, 13 ) );
+  Z3i::DigitalSet sites( domain );
+  for ( unsigned int i = 0; i < 20; ++i )
+    sites.insert( Z3i::Point( -3 + rand() % 20, rand() % 13, 2 + rand() % 12 ) );
+
+  bool ok = true;
+  for ( unsigned int i = 0; i < 8; ++i )
+    {
+      const std::array<bool, 3> periodicity = { { ( i & 1 ) != 0, ( i & 2 ) != 0, ( i & 4 ) != 0 } };
+      ok = ok && checkOutOfCore( domain, sites, 3 * 20 * 13, periodicity );
+    }
+  ok = ok && checkOutOfCore( domain, sites, 1, { { false, false, true } } );
+  ok = ok && checkOutOfCore( domain, sites, 1000, { { true, false, false } },
+                             ParallelExecutionPolicy( 2 ).withBatchSize( 3 ) );
+  // The last pass cuts slabs along the thin second dimension.
+  Z3i::Domain     thin( Z3i::Point( -3, 0, 2 ), Z3i::Point( 16, 2, 13 ) );
+  Z3i::DigitalSet thinSites( thin );
+  for ( auto const & p : sites )
+    if ( p[ 1 ] <= 2 ) thinSites.insert( p );
+  thinSites.insert( Z3i::Point( 0, 1, 5 ) );
+  ok = ok && checkOutOfCore( thin, thinSites, 1, { { false, true, false } } );
+  trace.endBlock();
+  return ok;
+}
+
+bool testOutOfCoreVoronoiMap2D()
+{
+  trace.beginBlock( "Testing OutOfCoreVoronoiMap in 2D" );
+  Z2i::Domain     domain( Z2i::Point( 0, 0 ), Z2i::Point( 40, 25 ) );
+  Z2i::DigitalSet sites( domain );
+  sites.insert( Z2i::Point( 3, 4 ) );
+  sites.insert( Z2i::Point( 35, 20 ) );
+  sites.insert( Z2i::Point( 20, 0 ) );
+  bool ok = checkOutOfCore( domain, sites, 100, { { false, false } } )
+    && checkOutOfCore( domain, sites, 100, { { true, true } } );
+  trace.endBlock();
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class OutOfCoreVoronoiMap" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testOutOfCoreVoronoiMap3D()
+    && testOutOfCoreVoronoiMap2D()
+    ; // && ... other tests
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -35,6 +35,7 @@
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/volumes/distance/PowerMap.h"
 #include "DGtal/geometry/volumes/distance/ReducedMedialAxis.h"
+#include "DGtal/geometry/volumes/distance/ReverseDistanceTransformation.h"
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpPowerSeparableMetric.h"
 #include "DGtal/kernel/sets/DigitalSetDomain.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
@@ -155,6 +156,47 @@ bool testReducedMedialAxis( std::array<bool, 2> const& aPeriodicity = {{ false,
   return nbok == nb;
 }
 
+/**
+ * Checks that the reduced medial axis of a reverse distance
+ * transformation computed with threads matches the serial one.
+ */
+bool testParallelReducedMedialAxis()
+{
+  trace.beginBlock ( "Testing parallel ReducedMedialAxis ..." );
+
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 18, 15, 11 ) );
+  using Image = ImageContainerBySTLVector< Z3i::Domain, DGtal::int64_t >;
+  Image image( domain );
+  for ( auto const & p : domain )
+    image.setValue( p, ( p[0] * 7 + p[1] * 3 + p[2] * 5 ) % 11 == 0 ? ( p[0] + p[1] ) % 5 + 1 : 0 );
+
+  using Power = PowerMap< Image, Z3i::L2PowerMetric >;
+  using RDT   = ReverseDistanceTransformation< Image, Z3i::L2PowerMetric >;
+  using RMA   = ReducedMedialAxis< Power >;
+  Z3i::L2PowerMetric l2power;
+  Power serial( &domain, &image, &l2power );
+  Power parallel( &domain, &image, &l2power, ParallelExecutionPolicy( 3 ).withBatchSize( 5 ) );
+  RDT   rdtSerial( &domain, &image, &l2power );
+  RDT   rdtParallel( &domain, &image, &l2power, ParallelExecutionPolicy( 0 ) );
+  bool ok = std::equal( serial.constRange().begin(), serial.constRange().end(),
+                        parallel.constRange().begin() );
+  for ( auto const & p : domain )
+    ok = ok && rdtSerial( p ) == rdtParallel( p );
+
+  RMA::Type maSerial   = RMA::getReducedMedialAxisFromPowerMap( serial );
+  RMA::Type maParallel = RMA::getReducedMedialAxisFromPowerMap( serial, ParallelExecutionPolicy( 3 ) );
+  // Both maps store exactly the same balls, i.e. (center, radius) pairs.
+  auto const & ballsSerial   = *maSerial.getPointer();
+  auto const & ballsParallel = *maParallel.getPointer();
+  const std::size_t nbBalls  = ballsSerial.size();
+  ok = ok && nbBalls > 0 && nbBalls < domain.size()
+    && nbBalls == ballsParallel.size()
+    && std::equal( ballsSerial.begin(), ballsSerial.end(), ballsParallel.begin() );
+  trace.info() << "#balls=" << nbBalls << " same=" << ok << std::endl;
+  trace.endBlock();
+  return ok;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -171,6 +213,7 @@ int main( int argc, char** argv )
     && testReducedMedialAxis( {{ true,  false }} )
     && testReducedMedialAxis( {{ false, true  }} )
     && testReducedMedialAxis( {{ true,  true  }} )
+    && testParallelReducedMedialAxis()
   ; // && ... other tests
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -674,6 +674,47 @@ bool testSimple4D()
   return ok;
 }
 
+bool testParallelVoronoiMap()
+{
+  Z3i::Point a(-3, 0, 2);
+  Z3i::Point b(17, 12, 15);
+  Z3i::Domain domain(a,b);
+
+  Z3i::DigitalSet sites(domain);
+  for(unsigned int i = 0 ; i < 24; ++i)
+    sites.insert( Z3i::Point( a[0] + rand() % 21, a[1] + rand() % 13, a[2] + rand() % 14 ) );
+
+  typedef functors::NotPointPredicate<Z3i::DigitalSet> Predicate;
+  typedef VoronoiMap<Z3i::Space, Predicate, Z3i::L2Metric> Voro;
+  Predicate predicate( sites );
+  const ParallelExecutionPolicy policies[] =
+    { ParallelExecutionPolicy( 3 ).withBatchSize( 4 ),
+      ParallelExecutionPolicy( 0 ).withBatchSize( 1 ),
+      ParallelExecutionPolicy( 2 ).withBatchSize( 64 ) };
+
+  bool ok = true;
+  for ( std::size_t i = 0; i < 8; ++i )
+    {
+      auto const periodicity = getPeriodicityFromInteger<3>(i);
+      trace.beginBlock( "Parallel 3D with periodicity " + formatPeriodicity(periodicity) );
+      Voro serial( domain, predicate, Z3i::l2Metric, periodicity );
+      for ( auto const & policy : policies )
+        {
+          Voro parallel( domain, predicate, Z3i::l2Metric, periodicity, policy );
+          DistanceTransformation<Z3i::Space, Predicate, Z3i::L2Metric>
+            dt( domain, predicate, Z3i::l2Metric, periodicity, policy );
+          const bool same = std::equal( serial.constRange().begin(), serial.constRange().end(),
+                                        parallel.constRange().begin() );
+          trace.info() << "threads=" << policy.nbThreads << " batch=" << policy.batchSize
+                       << " same=" << same << std::endl;
+          ok = ok && same && dt.policy().nbThreads == policy.nbThreads;
+        }
+      trace.endBlock();
+    }
+
+  return ok;
+}
+
 
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
@@ -696,6 +737,7 @@ int main( int argc, char** argv )
     && testSimple3D()
     && testSimpleRandom3D()
     && testSimple4D()
+    && testParallelVoronoiMap()
     ; // && ... other tests
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -82,5 +82,64 @@ SCENARIO( "Shortcuts< K3 > pointel ordering", "[shortcuts][pointel]" )
   }
 }
 
+SCENARIO( "Shortcuts< K3 > mesh voxelization", "[shortcuts][mesh]" )
+{
+  typedef KhalimskySpaceND<3>                       KSpace;
+  typedef Shortcuts< KSpace >                       SH3;
+
+  // Cube [-3.3,4.6]^3
+  auto cube = CountedPtr< SH3::Mesh >( new SH3::Mesh );
+  for ( int i = 0; i < 8; i++ )
+    cube->addVertex( SH3::RealPoint( i & 1 ? 4.6 : -3.3,
+                                     i & 2 ? 4.6 : -3.3,
+                                     i & 4 ? 4.6 : -3.3 ) );
+  cube->addFace( { 0, 2, 3, 1 } );
+  cube->addFace( { 4, 5, 7, 6 } );
+  cube->addFace( { 0, 1, 5, 4 } );
+  cube->addFace( { 2, 6, 7, 3 } );
+  cube->addFace( { 0, 4, 6, 2 } );
+  cube->addFace( { 1, 3, 7, 5 } );
+
+  GIVEN( "A closed mesh voxelized into a binary image" ) {
+    auto params       = SH3::defaultParameters();
+    params( "meshScale", 2.0 )( "threads", 2 );
+    auto binary_image = SH3::makeBinaryImage( cube, params );
+    THEN( "The binary image is the solid scaled cube" ) {
+      REQUIRE( binary_image->count() == 16*16*16 );
+      REQUIRE( (*binary_image)( SH3::Point( -6, -6, -6 ) ) );
+      REQUIRE( (*binary_image)( SH3::Point(  9,  9,  9 ) ) );
+    }
+    THEN( "Its digital surface is the boundary of the cube" ) {
+      auto K       = SH3::getKSpace( binary_image, params );
+      auto surface = SH3::makeDigitalSurface( binary_image, K, params );
+      REQUIRE( surface->size() == 6*16*16 );
+    }
+  }
+  GIVEN( "An unknown fill rule" ) {
+    auto params = SH3::defaultParameters();
+    params( "meshFillRule", "evenodd" );
+    THEN( "No binary image is built" ) {
+      REQUIRE( SH3::makeBinaryImage( cube, params ).get() == nullptr );
+    }
+  }
+}
+
+SCENARIO( "Shortcuts< K3 > number of threads", "[shortcuts][threads]" )
+{
+  typedef KhalimskySpaceND<3>                       KSpace;
+  typedef Shortcuts< KSpace >                       SH3;
+
+  GIVEN( "Parameters with or without a number of threads" ) {
+    auto params = SH3::defaultParameters();
+    THEN( "Non negative numbers are kept, negative or missing ones give 1" ) {
+      REQUIRE( SH3::getNbThreads( params ) == 1 );
+      REQUIRE( SH3::getNbThreads( params( "threads", 0 ) ) == 0 );
+      REQUIRE( SH3::getNbThreads( params( "threads", 3 ) ) == 3 );
+      REQUIRE( SH3::getNbThreads( params( "threads", -2 ) ) == 1 );
+      REQUIRE( SH3::getNbThreads( SH3::parametersMesh() ) == 1 );
+    }
+  }
+}
+
 //                                                                           //
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,141 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class ImageContainerByBits.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <algorithm>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerByBits.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/SimpleThresholdForegroundPredicate.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerByBits.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing ImageContainerByBits" )
+{
+  typedef ImageContainerByBits< Z3i::Domain >               Image;
+  typedef ImageContainerBySTLVector< Z3i::Domain, bool >    Reference;
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< Image > ));
+
+  // Rows of 70 points: two words, the last one being partial.
+  Z3i::Domain domain( Z3i::Point( -5, 0, 2 ), Z3i::Point( 64, 6, 5 ) );
+  Reference   reference( domain );
+  unsigned int i = 0;
+  for ( auto && p : domain )
+    reference.setValue( p, ( p.norm() < 9.0 ) || ( ++i % 13 == 0 ) );
+  const auto sameAsReference = [&] ( const Image & image )
+    {
+      unsigned int nb_ok = 0;
+      for ( auto && p : domain ) nb_ok += image( p ) == reference( p ) ? 1 : 0;
+      return nb_ok == domain.size();
+    };
+
+  for ( auto encoding : { Image::BIT_PACKED, Image::RUN_LENGTH } )
+    {
+      Image image( domain, encoding );
+      REQUIRE( image.isValid() );
+      REQUIRE( image.count() == 0 );
+      REQUIRE( image.wordsPerRow() == 2 );
+      REQUIRE( image.nbRows() == 7 * 4 );
+
+      SECTION( "Values set point by point are read back" )
+        {
+          for ( auto && p : domain ) image.setValue( p, reference( p ) );
+          REQUIRE( sameAsReference( image ) );
+          REQUIRE( image.isValid() );
+          REQUIRE( image.count() == (Image::Size) std::count( reference.begin(), reference.end(), true ) );
+          // Clearing some points splits or shrinks runs.
+          for ( auto && p : domain )
+            if ( p[ 0 ] % 3 == 0 ) { image.setValue( p, false ); reference.setValue( p, false ); }
+          REQUIRE( sameAsReference( image ) );
+          REQUIRE( image.isValid() );
+        }
+
+      SECTION( "Iterators follow the domain order, like ImageContainerBySTLVector" )
+        {
+          std::copy( reference.begin(), reference.end(), image.begin() );
+          REQUIRE( sameAsReference( image ) );
+          REQUIRE( std::equal( reference.begin(), reference.end(), image.begin() ) );
+          const Image & cimage = image;
+          REQUIRE( ( cimage.end() - cimage.begin() ) == (std::ptrdiff_t) domain.size() );
+          REQUIRE( std::equal( cimage.begin(), cimage.end(), reference.begin() ) );
+          std::vector< bool > fromRange( image.constRange().begin(), image.constRange().end() );
+          REQUIRE( std::equal( fromRange.begin(), fromRange.end(), reference.begin() ) );
+        }
+
+      SECTION( "Rows are read and written as words" )
+        {
+          for ( auto && p : domain ) image.setValue( p, reference( p ) );
+          std::vector< Image::Word > words( image.wordsPerRow() );
+          Image other( domain, encoding == Image::BIT_PACKED ? Image::RUN_LENGTH : Image::BIT_PACKED );
+          for ( Image::Size r = 0; r < image.nbRows(); ++r )
+            {
+              image.getRowWords( r, words.data() );
+              words.back() |= ~Image::Word( 0 ) << 6; // padding bits are ignored
+              other.setRowWords( r, words.data() );
+            }
+          REQUIRE( sameAsReference( other ) );
+          REQUIRE( other.count() == image.count() );
+          const Z3i::Point q( 0, 3, 4 );
+          REQUIRE( image.rowStart( image.rowIndex( q ) ) == Z3i::Point( -5, 3, 4 ) );
+        }
+
+      SECTION( "Encodings can be converted" )
+        {
+          for ( auto && p : domain ) image.setValue( p, reference( p ) );
+          image.setEncoding( Image::RUN_LENGTH );
+          REQUIRE( sameAsReference( image ) );
+          image.setEncoding( Image::BIT_PACKED );
+          REQUIRE( sameAsReference( image ) );
+          REQUIRE( image.memoryUsage() <= ( domain.size() + 7 ) / 8 + 8 * image.nbRows() );
+          image.fill( true );
+          REQUIRE( image.count() == domain.size() );
+          image.setEncoding( Image::RUN_LENGTH );
+          REQUIRE( image.count() == domain.size() );
+        }
+
+      SECTION( "It is a model of point predicate" )
+        {
+          for ( auto && p : domain ) image.setValue( p, reference( p ) );
+          functors::SimpleThresholdForegroundPredicate< Image > predicate( image, false );
+          unsigned int nb_ok = 0;
+          for ( auto && p : domain ) nb_ok += predicate( p ) == reference( p ) ? 1 : 0;
+          REQUIRE( nb_ok == domain.size() );
+        }
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
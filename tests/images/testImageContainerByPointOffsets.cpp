@@ -0,0 +1,153 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class ImageContainerByPointOffsets.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerByPointOffsets.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/estimation/VoronoiCovarianceMeasure.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerByPointOffsets.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing ImageContainerByPointOffsets" )
+{
+  typedef ImageContainerByPointOffsets< Z3i::Domain, DGtal::int8_t > Image;
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< Image > ));
+
+  Z3i::Domain domain( Z3i::Point( -4, 0, 2 ), Z3i::Point( 10, 7, 9 ) );
+  Image image( domain );
+  REQUIRE( image.isValid() );
+
+  SECTION( "Every point is initially associated to itself" )
+    {
+      unsigned int nb_ok = 0;
+      for ( auto&& p : domain ) nb_ok += image( p ) == p ? 1 : 0;
+      REQUIRE( nb_ok == domain.size() );
+    }
+
+  SECTION( "Near, far and infinite values are stored exactly" )
+    {
+      const Z3i::Point inf = Z3i::Point::diagonal( NumberTraits< Z3i::Integer >::max() );
+      const Z3i::Point p( 3, 4, 5 );
+      image.setValue( p, p + Z3i::Point( -126, 127, 0 ) );
+      REQUIRE( image( p ) == p + Z3i::Point( -126, 127, 0 ) );
+      REQUIRE( image.nbOverflows() == 0 );
+      image.setValue( p, p + Z3i::Point( -127, 0, 0 ) );
+      REQUIRE( image( p ) == p + Z3i::Point( -127, 0, 0 ) );
+      REQUIRE( image.nbOverflows() == 1 );
+      image.setValue( p, inf );
+      REQUIRE( image( p ) == inf );
+      REQUIRE( image.nbOverflows() == 0 );
+      image.setValue( p, Z3i::Point( 1000, -1000, 0 ) );
+      Image copy( image );
+      image.setValue( p, p );
+      REQUIRE( image.nbOverflows() == 0 );
+      REQUIRE( copy( p ) == Z3i::Point( 1000, -1000, 0 ) );
+      REQUIRE( copy.memoryUsage() > image.memoryUsage() );
+    }
+
+  SECTION( "Overflowed values are kept by copies" )
+    {
+      const Z3i::Point far( 1000, -1000, 500 );
+      for ( auto&& p : domain ) image.setValue( p, far + p );
+      REQUIRE( image.nbOverflows() == domain.size() );
+      Image copy( domain );
+      copy = image;
+      unsigned int nb_ok = 0;
+      for ( auto&& p : domain ) nb_ok += copy( p ) == far + p ? 1 : 0;
+      REQUIRE( nb_ok == domain.size() );
+      REQUIRE( copy.nbOverflows() == domain.size() );
+    }
+}
+
+TEST_CASE( "Testing ImageContainerByPointOffsets as a Voronoi map storage" )
+{
+  typedef ImageContainerBySTLVector< Z3i::Domain, Z3i::Vector >  Full;
+  typedef ImageContainerByPointOffsets< Z3i::Domain >            Compact;
+  typedef ImageContainerByPointOffsets< Z3i::Domain, DGtal::int8_t > Tiny;
+  typedef functors::NotPointPredicate< Z3i::DigitalSet >          Predicate;
+
+  Z3i::Domain     domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 140, 12, 9 ) );
+  Z3i::DigitalSet sites( domain );
+  sites.insert( Z3i::Point( 1, 2, 3 ) );
+  sites.insert( Z3i::Point( 130, 10, 1 ) );
+  sites.insert( Z3i::Point( 70, 5, 8 ) );
+  Predicate predicate( sites );
+
+  SECTION( "Distance transformations do not depend on the storage" )
+    {
+      for ( unsigned int i = 0; i < 4; ++i )
+        {
+          const std::array< bool, 3 > periodicity = { { ( i & 1 ) != 0, ( i & 2 ) != 0, false } };
+          DistanceTransformation< Z3i::Space, Predicate, Z3i::L2Metric, Full >
+            dtFull( domain, predicate, Z3i::l2Metric, periodicity );
+          DistanceTransformation< Z3i::Space, Predicate, Z3i::L2Metric, Compact >
+            dtCompact( domain, predicate, Z3i::l2Metric, periodicity );
+          DistanceTransformation< Z3i::Space, Predicate, Z3i::L2Metric, Tiny >
+            dtTiny( domain, predicate, Z3i::l2Metric, periodicity,
+                    ParallelExecutionPolicy( 2 ).withBatchSize( 3 ) );
+          unsigned int nb_ok = 0;
+          for ( auto&& p : domain )
+            nb_ok += ( dtFull.getVoronoiVector( p ) == dtCompact.getVoronoiVector( p )
+                       && dtFull.getVoronoiVector( p ) == dtTiny.getVoronoiVector( p )
+                       && dtFull( p ) == dtCompact( p ) ) ? 1 : 0;
+          REQUIRE( nb_ok == domain.size() );
+          REQUIRE( std::equal( dtFull.constRange().begin(), dtFull.constRange().end(),
+                               dtCompact.constRange().begin() ) );
+        }
+    }
+
+  SECTION( "VoronoiCovarianceMeasure accepts a compact Voronoi map" )
+    {
+      typedef VoronoiCovarianceMeasure< Z3i::Space, Z3i::L2Metric >          VCM;
+      typedef VoronoiCovarianceMeasure< Z3i::Space, Z3i::L2Metric, Compact > CompactVCM;
+      std::vector< Z3i::Point > points;
+      for ( auto&& p : Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 9, 9, 0 ) ) )
+        points.push_back( p );
+      VCM        vcm( 3.0, 1.0, Z3i::l2Metric, false );
+      CompactVCM compactVcm( 3.0, 1.0, Z3i::l2Metric, false );
+      vcm.init( points.begin(), points.end() );
+      compactVcm.init( points.begin(), points.end() );
+      unsigned int nb_ok = 0;
+      for ( auto&& p : vcm.domain() )
+        nb_ok += vcm.voronoiMap()( p ) == compactVcm.voronoiMap()( p ) ? 1 : 0;
+      REQUIRE( nb_ok == vcm.domain().size() );
+      REQUIRE( vcm.vcmMap().size() == compactVcm.vcmMap().size() );
+    }
+}
+
+/** @ingroup Tests **/
@@ -0,0 +1,170 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class ImageContainerBySiteIndices.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySiteIndices.h"
+#include "DGtal/images/ImageContainerByPointOffsets.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerBySiteIndices.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing ImageContainerBySiteIndices" )
+{
+  typedef ImageContainerBySiteIndices< Z3i::Domain > Image;
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< Image > ));
+
+  Z3i::Domain domain( Z3i::Point( -4, 0, 2 ), Z3i::Point( 10, 7, 9 ) );
+  Image image( domain );
+  REQUIRE( image.isValid() );
+
+  SECTION( "Every point is initially associated to itself" )
+    {
+      unsigned int nb_ok = 0;
+      for ( auto&& p : domain ) nb_ok += image( p ) == p ? 1 : 0;
+      REQUIRE( nb_ok == domain.size() );
+      REQUIRE( image.nbOverflows() == 0 );
+    }
+
+  SECTION( "Far, unprojected, infinite and outer values are stored exactly" )
+    {
+      const Z3i::Point inf = Z3i::Point::diagonal( NumberTraits< Z3i::Integer >::max() );
+      const Z3i::Point p( 3, 4, 5 );
+      const Z3i::Point q( 10, 0, 2 );
+      image.setValue( p, domain.lowerBound() );
+      image.setValue( q, domain.upperBound() );
+      REQUIRE( image( p ) == domain.lowerBound() );
+      REQUIRE( image( q ) == domain.upperBound() );
+      // Sites shifted by one period along each dimension.
+      const Z3i::Point shift( 15, -8, 8 );
+      image.setValue( p, q + shift );
+      REQUIRE( image( p ) == q + shift );
+      REQUIRE( image.nbOverflows() == 0 );
+      image.setValue( p, inf );
+      REQUIRE( image( p ) == inf );
+      image.setValue( p, Z3i::Point( 1000, -1000, 0 ) );
+      REQUIRE( image( p ) == Z3i::Point( 1000, -1000, 0 ) );
+      REQUIRE( image.nbOverflows() == 1 );
+      Image copy( image );
+      image.setValue( p, p );
+      REQUIRE( image.nbOverflows() == 0 );
+      REQUIRE( copy( p ) == Z3i::Point( 1000, -1000, 0 ) );
+      REQUIRE( copy.memoryUsage() > image.memoryUsage() );
+    }
+
+  SECTION( "Too small indices encode only the domain" )
+    {
+      // 30x20x20 points fit in 16 bits, but not the 27x bigger box.
+      typedef ImageContainerBySiteIndices< Z3i::Domain, DGtal::uint16_t > SmallImage;
+      const Z3i::Domain big( Z3i::Point( -10, 0, 0 ), Z3i::Point( 19, 19, 19 ) );
+      const Z3i::Point  lo = big.lowerBound();
+      const Z3i::Point  hi = big.upperBound();
+      SmallImage small( big );
+      unsigned int nb_ok = 0;
+      for ( auto&& p : big )
+        {
+          small.setValue( p, hi + lo - p );
+          nb_ok += small( p ) == hi + lo - p ? 1 : 0;
+        }
+      REQUIRE( nb_ok == big.size() );
+      REQUIRE( small.nbOverflows() == 0 );
+      small.setValue( lo, lo - Z3i::Point( 1, 0, 0 ) );
+      REQUIRE( small( lo ) == lo - Z3i::Point( 1, 0, 0 ) );
+      REQUIRE( small.nbOverflows() == 1 );
+    }
+}
+
+TEST_CASE( "Testing ImageContainerBySiteIndices as a Voronoi map storage" )
+{
+  typedef ImageContainerBySTLVector< Z3i::Domain, Z3i::Vector >  Full;
+  typedef ImageContainerBySiteIndices< Z3i::Domain >             Indices;
+  typedef ImageContainerByPointOffsets< Z3i::Domain >            Offsets;
+  typedef functors::NotPointPredicate< Z3i::DigitalSet >          Predicate;
+
+  Z3i::Domain     domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 140, 12, 9 ) );
+  Z3i::DigitalSet sites( domain );
+  sites.insert( Z3i::Point( 1, 2, 3 ) );
+  sites.insert( Z3i::Point( 130, 10, 1 ) );
+  sites.insert( Z3i::Point( 70, 5, 8 ) );
+  Predicate predicate( sites );
+
+  SECTION( "Distance transformations do not depend on the storage" )
+    {
+      for ( unsigned int i = 0; i < 8; ++i )
+        {
+          const std::array< bool, 3 > periodicity
+            = { { ( i & 1 ) != 0, ( i & 2 ) != 0, ( i & 4 ) != 0 } };
+          DistanceTransformation< Z3i::Space, Predicate, Z3i::L2Metric, Full >
+            dtFull( domain, predicate, Z3i::l2Metric, periodicity );
+          DistanceTransformation< Z3i::Space, Predicate, Z3i::L2Metric, Indices >
+            dtIndices( domain, predicate, Z3i::l2Metric, periodicity,
+                       ParallelExecutionPolicy( 2 ).withBatchSize( 3 ) );
+          unsigned int nb_ok = 0;
+          for ( auto&& p : domain )
+            nb_ok += ( dtFull.getVoronoiVector( p ) == dtIndices.getVoronoiVector( p )
+                       && dtFull( p ) == dtIndices( p ) ) ? 1 : 0;
+          REQUIRE( nb_ok == domain.size() );
+          REQUIRE( std::equal( dtFull.constRange().begin(), dtFull.constRange().end(),
+                               dtIndices.constRange().begin() ) );
+        }
+    }
+
+  SECTION( "Voronoi maps take a third of the memory of full points" )
+    {
+      DistanceTransformation< Z3i::Space, Predicate, Z3i::L2Metric, Full >
+        dtFull( domain, predicate, Z3i::l2Metric, { { true, true, true } } );
+      Indices indices( domain );
+      Offsets offsets( domain );
+      for ( auto&& p : domain )
+        {
+          indices.setValue( p, dtFull.getVoronoiVector( p ) );
+          offsets.setValue( p, dtFull.getVoronoiVector( p ) );
+        }
+      const std::size_t full  = domain.size() * sizeof( Z3i::Point );
+      const std::size_t table = OverflowTable< Z3i::Point >().memoryUsage();
+      trace.info() << "memory: full=" << full << " offsets=" << offsets.memoryUsage()
+                   << " indices=" << indices.memoryUsage() << std::endl;
+      // Aside from the (empty) overflow tables, 4 bytes per point
+      // instead of 12, and 6 bytes for 16-bit offsets.
+      REQUIRE( indices.nbOverflows() == 0 );
+      REQUIRE( offsets.nbOverflows() == 0 );
+      REQUIRE( 3 * ( indices.memoryUsage() - table ) == full );
+      REQUIRE( 2 * ( offsets.memoryUsage() - table ) == full );
+    }
+}
+
+/** @ingroup Tests **/
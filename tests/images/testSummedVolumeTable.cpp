@@ -0,0 +1,115 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class SummedVolumeTable.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/SummedVolumeTable.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SummedVolumeTable.
+///////////////////////////////////////////////////////////////////////////////
+
+namespace {
+  // A "random looking" shape.
+  struct Shape
+  {
+    bool operator()( const Z3i::Point& p ) const
+    { return ( ( p[ 0 ] * 7 + p[ 1 ] * 13 + p[ 2 ] * 5 ) % 3 ) == 0 || p.norm() < 4.0; }
+  };
+
+  unsigned int bruteForceSum( const Z3i::Domain& domain, const Shape& shape,
+                              const Z3i::Point& lo, const Z3i::Point& hi )
+  {
+    unsigned int n = 0;
+    for ( auto&& p : domain )
+      if ( lo.isLower( p ) && p.isLower( hi ) && shape( p ) ) ++n;
+    return n;
+  }
+}
+
+TEST_CASE( "Testing SummedVolumeTable" )
+{
+  typedef SummedVolumeTable< Z3i::Domain > SVT;
+  Shape       shape;
+  Z3i::Domain domain( Z3i::Point( -6, -5, -4 ), Z3i::Point( 7, 5, 6 ) );
+  SVT         svt( domain, shape );
+  REQUIRE( svt.isValid() );
+
+  SECTION( "Box sums match brute force counts, even when clipped" )
+    {
+      std::vector< std::pair< Z3i::Point, Z3i::Point > > boxes =
+        { { domain.lowerBound(), domain.upperBound() },
+          { Z3i::Point( -2, -1, 0 ), Z3i::Point( 3, 2, 2 ) },
+          { Z3i::Point( 5, 3, 4 ), Z3i::Point( 12, 9, 10 ) },
+          { Z3i::Point( -10, -10, -10 ), Z3i::Point( -5, -4, -3 ) },
+          { Z3i::Point( 1, 1, 1 ), Z3i::Point( 1, 1, 1 ) },
+          { Z3i::Point( 2, 2, 2 ), Z3i::Point( 1, 3, 3 ) },
+          { Z3i::Point( 20, 20, 20 ), Z3i::Point( 30, 30, 30 ) } };
+      for ( auto&& b : boxes )
+        REQUIRE( svt.sum( b.first, b.second )
+                 == bruteForceSum( domain, shape, b.first, b.second ) );
+    }
+
+  SECTION( "A digital ball is exactly decomposed into disjoint boxes" )
+    {
+      std::vector< Z3i::Point > ball;
+      Z3i::Domain ballDomain( Z3i::Point::diagonal( -4 ), Z3i::Point::diagonal( 4 ) );
+      for ( auto&& p : ballDomain )
+        if ( p.squaredNorm() <= 13 ) ball.push_back( p );
+      auto decomposition = SVT::decomposeIntoBoxes( ball.begin(), ball.end() );
+      std::multiset< Z3i::Point > covered;
+      for ( auto&& b : decomposition )
+        for ( auto&& p : Z3i::Domain( b.first, b.second ) )
+          covered.insert( p );
+      REQUIRE( covered.size() == ball.size() );
+      REQUIRE( std::set< Z3i::Point >( ball.begin(), ball.end() )
+               == std::set< Z3i::Point >( covered.begin(), covered.end() ) );
+      REQUIRE( decomposition.size() < ball.size() / 4 );
+
+      const Z3i::Point shift( 1, -1, 2 );
+      unsigned int n = 0;
+      for ( auto&& p : ball )
+        n += ( domain.isInside( p + shift ) && shape( p + shift ) ) ? 1 : 0;
+      REQUIRE( svt.sum( decomposition.begin(), decomposition.end(), shift ) == n );
+    }
+}
+
+TEST_CASE( "Testing SummedVolumeTable in 2D with small values" )
+{
+  // 8 bits counters overflow on the whole table, but box sums stay exact.
+  typedef SummedVolumeTable< Z2i::Domain, unsigned char > SVT;
+  Z2i::Domain domain( Z2i::Point( 0, 0 ), Z2i::Point( 39, 39 ) );
+  SVT svt( domain, [] ( const Z2i::Point& ) { return true; } );
+  REQUIRE( svt.sum( Z2i::Point( 10, 10 ), Z2i::Point( 19, 19 ) ) == 100 );
+  REQUIRE( svt.sum( Z2i::Point( 30, 35 ), Z2i::Point( 45, 45 ) ) == 50 );
+}
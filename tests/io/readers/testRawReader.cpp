@@ -117,6 +117,13 @@ void testRawReaderOnRef()
   INFO( "Reading file with importRaw" << fileName );
   Image imageRaw = RawReader<Image>::template importRaw< unsigned int >( fileName, extent );
   testImageOnRef( imageRaw );
+
+  INFO( "Mapping file with mapRaw" << fileName );
+  typedef MemoryMappedImage< unsigned int, Domain > MappedImage;
+  MappedImage mapped = RawReader<Image>::template mapRaw< unsigned int >( fileName, extent );
+  // Raw files are in the byte order of the host, hence read in place.
+  REQUIRE( mapped.isZeroCopy() );
+  testImageOnRef( mapped );
 }
 
 /** Compares an image to a generated data.
@@ -33,6 +33,7 @@
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/images/ImageSelector.h"
+#include "DGtal/images/CConstImage.h"
 #include "DGtal/io/readers/VolReader.h"
 #include "DGtal/io/colormaps/HueShadeColorMap.h"
 #include "DGtal/io/colormaps/GrayscaleColorMap.h"
@@ -166,6 +167,44 @@ bool testConsistence()
   return true;
 }
 
+bool testMapVol()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing VolReader::mapVol ..." );
+
+  typedef SpaceND<3> Space4Type;
+  typedef HyperRectDomain<Space4Type> TDomain;
+  typedef ImageSelector<TDomain, unsigned char>::Type Image;
+  BOOST_CONCEPT_ASSERT(( concepts::CConstImage< VolReader<Image>::MappedImage > ));
+
+  // Compressed file: uncompressed into a buffer.
+  std::string filename = testPath + "samples/cat10.vol";
+  Image image = VolReader<Image>::importVol( filename );
+  VolReader<Image>::MappedImage mapped = VolReader<Image>::mapVol( filename );
+  trace.info() << mapped << std::endl;
+  nbok += ( ! mapped.isZeroCopy()
+            && std::equal( image.begin(), image.end(), mapped.begin() ) ) ? 1 : 0;
+  nb++;
+
+  // Uncompressed file: voxels read in place.
+  VolWriter<Image>::exportVol( "cat10-uncompressed.vol", image, false );
+  VolReader<Image>::MappedImage mapped2 = VolReader<Image>::mapVol( "cat10-uncompressed.vol" );
+  trace.info() << mapped2 << std::endl;
+  bool same = mapped2.isZeroCopy() && mapped2.domain().lowerBound() == image.domain().lowerBound()
+    && mapped2.domain().upperBound() == image.domain().upperBound();
+  for ( auto && p : image.domain() )
+    same = same && mapped2( p ) == image( p );
+  nbok += same ? 1 : 0;
+  nb++;
+
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -180,7 +219,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testVolReader() && testIOException() && testConsistence(); // && ... other tests
+  bool res = testVolReader() && testIOException() && testConsistence()
+    && testMapVol(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -29,6 +29,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/images/ImageSelector.h"
@@ -84,6 +85,45 @@ bool testLongvol()
   return nbok == nb;
 }
 
+/**
+ * Maps compressed and uncompressed longvol files, with values using
+ * all their 64 bits.
+ */
+bool testMapLongvol()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing LongvolReader::mapLongvol ..." );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint64_t> Image;
+  Image image( Z3i::Domain( Z3i::Point( -3, 0, 2 ), Z3i::Point( 8, 5, 6 ) ) );
+  DGtal::uint64_t v = 1;
+  for ( auto && p : image.domain() )
+    image.setValue( p, ( v++ * 0x9E3779B97F4A7C15ULL ) >> ( p[ 0 ] & 7 ) );
+
+  for ( bool compressed : { false, true } )
+    {
+      LongvolWriter<Image>::exportLongvol( "export-map.longvol", image, compressed );
+      LongvolReader<Image>::MappedImage mapped
+        = LongvolReader<Image>::mapLongvol( "export-map.longvol" );
+      trace.info() << mapped << std::endl;
+      bool same = mapped.domain().lowerBound() == image.domain().lowerBound()
+        && mapped.domain().upperBound() == image.domain().upperBound();
+      for ( auto && p : image.domain() )
+        same = same && mapped( p ) == image( p );
+      nbok += same ? 1 : 0;
+      nb++;
+      Image copy = LongvolReader<Image>::importLongvol( "export-map.longvol" );
+      nbok += std::equal( copy.begin(), copy.end(), image.begin() ) ? 1 : 0;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -95,7 +135,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testLongvol(); // && ... other tests
+  bool res = testLongvol() && testMapLongvol(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,160 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkDigitalSetSelector.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Benchmarks the containers chosen by DigitalSetSelector, for the
+ * typical uses corresponding to its hints.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include <boost/container/flat_set.hpp>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/DenseSetByBits.h"
+#include "DGtal/kernel/UnorderedSetByBlock.h"
+#include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+
+#include "DGtalCatch.h"
+
+using namespace DGtal;
+using namespace std;
+
+/// Timer used in tic and toc
+auto tic_timer = std::chrono::high_resolution_clock::now();
+
+/// Starts timer
+void tic()
+{
+  tic_timer = std::chrono::high_resolution_clock::now();
+}
+
+/// Ends timer and return elapsed time
+double toc()
+{
+  const auto toc_timer = std::chrono::high_resolution_clock::now();
+  const std::chrono::duration<double> time_span = toc_timer - tic_timer;
+  return time_span.count();
+}
+
+typedef Z3i::Domain Domain;
+typedef Z3i::Point  Point;
+typedef DigitalSetBySTLVector< Domain > VectorSet;
+typedef DigitalSetByAssociativeContainer< Domain, boost::container::flat_set< Point > > SortedSet;
+typedef DigitalSetByAssociativeContainer< Domain, std::unordered_set< Point > > HashSet;
+typedef DigitalSetByAssociativeContainer< Domain, UnorderedSetByBlock< Point > > BlockSet;
+typedef DigitalSetByAssociativeContainer< Domain, DenseSetByBits< Point > > BitSet;
+
+/**
+ * Inserts \a points in a set of type \a Set, then tests the
+ * belonging of \a queries \a nb times and traverses the set \a nb
+ * times. Times are in ms.
+ */
+template <typename Set>
+void bench( const std::string & name, const Domain & domain,
+            const std::vector< Point > & points,
+            const std::vector< Point > & queries, int nb )
+{
+  Point check;
+  std::size_t found = 0;
+  tic();
+  Set set( domain );
+  for ( auto&& p : points ) set.insert( p );
+  const double tInsert = toc();
+  tic();
+  for ( int i = 0; i < nb; ++i )
+    for ( auto&& q : queries ) found += set( q ) ? 1 : 0;
+  const double tBelong = toc();
+  tic();
+  for ( int i = 0; i < nb; ++i )
+    for ( auto&& p : set ) check += p;
+  const double tTraverse = toc();
+  trace.info() << name << ": #=" << set.size()
+               << " insert=" << 1e3 * tInsert << " ms"
+               << " belong=" << 1e3 * tBelong << " ms"
+               << " traverse=" << 1e3 * tTraverse << " ms"
+               << " (check " << found << " " << check << ")" << std::endl;
+}
+
+TEST_CASE( "Benchmarking DigitalSetSelector containers" )
+{
+  srand( 0 );
+  SECTION( "SMALL_DS + LOW_VAR_DS: neighborhoods, sorted vector" )
+    {
+      // Many small sets, like the ones of Object::isSimple.
+      const Domain domain( Point::diagonal( -1 ), Point::diagonal( 1 ) );
+      std::vector< Point > points;
+      for ( auto&& p : domain ) if ( rand() % 3 != 0 ) points.push_back( p );
+      std::vector< Point > queries( domain.begin(), domain.end() );
+      for ( int k = 0; k < 3; ++k )
+        {
+          bench< VectorSet >( "vector        ", domain, points, queries, 100000 );
+          bench< SortedSet >( "sorted vector ", domain, points, queries, 100000 );
+          bench< HashSet   >( "unordered_set ", domain, points, queries, 100000 );
+        }
+    }
+  SECTION( "WHOLE_DS: a ball filling its domain, dense bits" )
+    {
+      const Domain domain( Point::diagonal( -64 ), Point::diagonal( 63 ) );
+      std::vector< Point > points;
+      for ( auto&& p : domain ) if ( p.norm() < 60.0 ) points.push_back( p );
+      std::vector< Point > queries;
+      for ( int i = 0; i < 1000000; ++i )
+        queries.push_back( Point( rand() % 128 - 64, rand() % 128 - 64, rand() % 128 - 64 ) );
+      bench< HashSet  >( "unordered_set ", domain, points, queries, 1 );
+      bench< BlockSet >( "blocks        ", domain, points, queries, 1 );
+      bench< BitSet   >( "dense bits    ", domain, points, queries, 1 );
+    }
+  SECTION( "BIG_DS: sparse points in a big domain, blocks" )
+    {
+      // Note that the dense bits are reserved to the whole domain (128MB).
+      const Domain domain( Point::diagonal( -512 ), Point::diagonal( 511 ) );
+      std::vector< Point > points, queries;
+      // Random segments along the first axis, as in digital surfaces.
+      for ( int i = 0; i < 50000; ++i )
+        {
+          const Point p( rand() % 1000 - 500, rand() % 1024 - 512, rand() % 1024 - 512 );
+          for ( int j = 0; j < 8; ++j ) points.push_back( p + Point( j, 0, 0 ) );
+        }
+      for ( int i = 0; i < 1000000; ++i )
+        queries.push_back( points[ rand() % points.size() ] + Point( rand() % 3 - 1, 0, 0 ) );
+      bench< HashSet  >( "unordered_set ", domain, points, queries, 1 );
+      bench< BlockSet >( "blocks        ", domain, points, queries, 1 );
+      bench< BitSet   >( "dense bits    ", domain, points, queries, 1 );
+      UnorderedSetByBlock< Point > blocks;
+      blocks.insert( points.begin(), points.end() );
+      DenseSetByBits< Point > bits;
+      bits.insert( points.begin(), points.end() );
+      trace.info() << "memory: unordered_set=" << blocks.memory_usage_unordered_set()
+                   << " blocks=" << blocks.memory_usage()
+                   << " dense bits=" << bits.memory_usage() << std::endl;
+    }
+}
+
+/** @ingroup Tests **/
@@ -0,0 +1,226 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDenseSetByBits.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class DenseSetByBits.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <set>
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/kernel/DenseSetByBits.h"
+#include "DGtal/kernel/sets/DigitalSetSelector.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+template < typename Point >
+Point randomPoint( int S )
+{
+  Point p;
+  for ( DGtal::Dimension i = 0; i < Point::dimension; i++ )
+    p[ i ] = (rand() % S) - S/2;
+  return p;
+}
+
+/// Tells if \a p comes before \a q in the traversal of a DenseSetByBits.
+template < typename Point >
+bool isBefore( const Point & p, const Point & q )
+{
+  for ( DGtal::Dimension i = Point::dimension; i-- > 0; )
+    if ( p[ i ] != q[ i ] ) return p[ i ] < q[ i ];
+  return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DenseSetByBits.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "DenseSetByBits< PointVector< 3, int > > unit tests", "[densesetbybits][3d]" )
+{
+  typedef PointVector< 3, int32_t > Point;
+  typedef std::set< Point >         StdSet;
+  typedef DenseSetByBits< Point >   BitSet;
+
+  const int nb_inserted = 400;
+  const int nb_sought   = 400;
+  const int nb_erased   = 200;
+
+  // Points are inserted in an initial box that is too small, and
+  // spans more than one word along x.
+  StdSet stdSet;
+  BitSet bitSet( Point( -3, -3, -3 ), Point( 3, 3, 3 ) );
+  for ( int i = 0; i < nb_inserted; i++ )
+    {
+      Point p = randomPoint<Point>( 20 );
+      p[ 0 ] *= 7;
+      REQUIRE( stdSet.insert( p ).second == bitSet.insert( p ).second );
+    }
+  WHEN( "Inserting identical elements in std::set<> and in DenseSetByBits<>, they contain the same elements" ) {
+    REQUIRE( bitSet.size() == stdSet.size() );
+    for ( auto&& p : stdSet )
+      {
+        REQUIRE( bitSet.count( p ) == 1 );
+        REQUIRE( bitSet.lowerBound().isLower( p ) );
+        REQUIRE( bitSet.upperBound().isUpper( p ) );
+      }
+  }
+  WHEN( "Traversing a DenseSetByBits<>, its elements are visited once, last coordinate first" ) {
+    std::vector< Point > bitTrv( bitSet.begin(), bitSet.end() );
+    REQUIRE( bitTrv.size() == stdSet.size() );
+    bool ordered = true;
+    for ( std::size_t i = 1; i < bitTrv.size(); i++ )
+      ordered = ordered && isBefore( bitTrv[ i - 1 ], bitTrv[ i ] );
+    REQUIRE( ordered );
+    std::sort( bitTrv.begin(), bitTrv.end() );
+    REQUIRE( std::equal( stdSet.cbegin(), stdSet.cend(), bitTrv.cbegin() ) );
+  }
+  WHEN( "Looking for elements in identical std::set<> and DenseSetByBits<>, the same elements are found" ) {
+    for ( int i = 0; i < nb_sought; i++ )
+      {
+        Point p = randomPoint<Point>( 200 );
+        const bool in = stdSet.count( p ) != 0;
+        REQUIRE( ( bitSet.count( p ) != 0 ) == in );
+        auto it = bitSet.find( p );
+        REQUIRE( ( it != bitSet.end() ) == in );
+        if ( in )
+          {
+            REQUIRE( *it == p );
+            auto itStd = stdSet.find( p );
+            // The traversal continues from the found element.
+            std::size_t nb = 0;
+            for ( ; it != bitSet.end(); ++it ) nb++;
+            REQUIRE( nb == std::size_t( std::count_if( stdSet.begin(), stdSet.end(),
+                                                       [&p] ( const Point & q )
+                                                       { return ! isBefore( q, p ); } ) ) );
+            REQUIRE( itStd != stdSet.end() );
+          }
+      }
+  }
+  WHEN( "Erasing elements in identical std::set<> and DenseSetByBits<>, the same elements are left" ) {
+    for ( int i = 0; i < nb_erased; i++ )
+      {
+        Point p = randomPoint<Point>( 20 );
+        p[ 0 ] *= 7;
+        REQUIRE( stdSet.erase( p ) == bitSet.erase( p ) );
+      }
+    REQUIRE( bitSet.size() == stdSet.size() );
+    // Erases every other element by iterator.
+    auto it = bitSet.begin();
+    while ( it != bitSet.end() )
+      {
+        stdSet.erase( *it );
+        it = bitSet.erase( it );
+        if ( it != bitSet.end() ) ++it;
+      }
+    REQUIRE( bitSet.size() == stdSet.size() );
+    for ( auto&& p : stdSet ) REQUIRE( bitSet.count( p ) == 1 );
+    bitSet.erase( bitSet.begin(), bitSet.end() );
+    REQUIRE( bitSet.empty() );
+  }
+  WHEN( "Comparing, copying and swapping DenseSetByBits<>, they behave as std::set<>" ) {
+    BitSet other( bitSet );
+    REQUIRE( other == bitSet );
+    other.erase( *bitSet.begin() );
+    REQUIRE( other != bitSet );
+    BitSet empty;
+    empty.swap( other );
+    REQUIRE( other.empty() );
+    REQUIRE( empty.size() + 1 == bitSet.size() );
+    bitSet.clear();
+    REQUIRE( bitSet.empty() );
+    REQUIRE( bitSet.begin() == bitSet.end() );
+  }
+}
+
+SCENARIO( "DigitalSetSelector chooses its container according to its hints", "[densesetbybits][selector]" )
+{
+  typedef Z3i::Domain Domain;
+  typedef Z3i::Point  Point;
+  typedef DigitalSetSelector< Domain, SMALL_DS + HIGH_ITER_DS >::Type Small;
+  typedef DigitalSetSelector< Domain, WHOLE_DS >::Type                Dense;
+  typedef DigitalSetSelector< Domain, BIG_DS + HIGH_BEL_DS >::Type    Hash;
+  typedef DigitalSetSelector< Domain, BIG_DS + HIGH_VAR_DS >::Type    Blocks;
+  typedef DigitalSetSelector< Domain, MEDIUM_DS >::Type               Medium;
+  BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet< Small > ));
+  BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet< Dense > ));
+  BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet< Blocks > ));
+  REQUIRE(( std::is_same< Small::Container, boost::container::flat_set< Point > >::value ));
+  REQUIRE(( std::is_same< Dense::Container, DenseSetByBits< Point > >::value ));
+  REQUIRE(( std::is_same< Hash::Container, std::unordered_set< Point > >::value ));
+  REQUIRE(( std::is_same< Blocks::Container, UnorderedSetByBlock< Point > >::value ));
+  REQUIRE(( std::is_same< Medium::Container, std::unordered_set< Point > >::value ));
+  REQUIRE(( std::is_same< Z3i::DigitalSet, Hash >::value ));
+
+  Domain domain( Point( -10, -10, -10 ), Point( 10, 10, 10 ) );
+  Dense  dense( domain );
+  Blocks blocks( domain );
+  Small  small( domain );
+  for ( auto&& p : domain )
+    if ( p.norm() <= 8.0 )
+      {
+        dense.insertNew( p );
+        blocks.insertNew( p );
+        if ( p.norm() <= 1.0 ) small.insertNew( p );
+      }
+  THEN( "The sets have the same elements" ) {
+    REQUIRE( dense.size() == blocks.size() );
+    REQUIRE( small.size() == 7 );
+    for ( auto&& p : blocks ) REQUIRE( dense( p ) );
+    Point lower, upper;
+    dense.computeBoundingBox( lower, upper );
+    REQUIRE( lower == Point::diagonal( -8 ) );
+    REQUIRE( upper == Point::diagonal( 8 ) );
+  }
+  THEN( "The dense bits are reserved to the domain and never grow" ) {
+    DenseSetByBits< Point > bits;
+    reserveForDomain( bits, domain.lowerBound(), domain.upperBound() );
+    const auto memory = bits.memory_usage();
+    Dense copy( domain );
+    copy = dense;
+    copy.clear();
+    for ( auto&& p : domain ) copy.insert( p );
+    REQUIRE( copy.size() == domain.size() );
+    REQUIRE( bits.lowerBound() == domain.lowerBound() );
+    REQUIRE( bits.upperBound() == domain.upperBound() );
+    // One 64 bits word per row of 21 points.
+    REQUIRE( memory <= sizeof( bits ) + 21 * 21 * sizeof( DGtal::uint64_t ) );
+  }
+  THEN( "Complement and union are consistent" ) {
+    Dense other( domain );
+    other.assignFromComplement( dense );
+    REQUIRE( other.size() + dense.size() == domain.size() );
+    other += dense;
+    REQUIRE( other.size() == domain.size() );
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
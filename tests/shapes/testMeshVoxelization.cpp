@@ -232,4 +232,128 @@ TEST_CASE("Basic voxelization test", "[voxelization]")
     //hard coded test.
     REQUIRE( outputSet.size() == 4162 );
   }
+  // ---------------------------------------------------------
+  SECTION("Multi-threaded voxelization of a OFF cube mesh")
+  {
+    Mesh<Z3i::RealPoint> inputMesh;
+    MeshReader<Z3i::RealPoint>::importOFFFile(testPath +"/samples/box.off" , inputMesh);
+    Z3i::Domain domain( Point().diagonal(-30), Point().diagonal(30));
+    DigitalSet outputSet6(domain), outputSet26(domain);
+    MeshVoxelizer6 voxelizer6;
+    MeshVoxelizer26 voxelizer26;
+
+    voxelizer6.voxelize(outputSet6, inputMesh, 10.0, 4 );
+    voxelizer26.voxelize(outputSet26, inputMesh, 10.0, 4 );
+    REQUIRE( outputSet6.size() == 2562 );
+    REQUIRE( outputSet26.size() == 4162 );
+
+    // Same voxels in a (partially covering) set and in images.
+    Z3i::Domain subDomain( Point(-30,-30,-5), Point(30,30,30) );
+    DigitalSet subSet(subDomain);
+    voxelizer6.voxelize(subSet, inputMesh, 10.0, 3 );
+    unsigned int nbInside = 0;
+    for(auto p: outputSet6)
+      if(subDomain.isInside(p))
+        nbInside++;
+    REQUIRE( subSet.size() == nbInside );
+
+    MeshVoxelizer6::BinaryImage image(domain);
+    voxelizer6.voxelize(image, inputMesh, 10.0, 0 );
+    REQUIRE( image.count() == 2562 );
+    MeshVoxelizer6::BinaryImage rlImage(domain, MeshVoxelizer6::BinaryImage::RUN_LENGTH);
+    voxelizer6.voxelize(rlImage, inputMesh, 10.0, 2 );
+    REQUIRE( rlImage.encoding() == MeshVoxelizer6::BinaryImage::RUN_LENGTH );
+    unsigned int nbSame = 0;
+    for(auto p: outputSet6)
+      if(image(p) && rlImage(p))
+        nbSame++;
+    REQUIRE( nbSame == 2562 );
+    REQUIRE( rlImage.count() == 2562 );
+  }
+  // ---------------------------------------------------------
+  SECTION("Solid voxelization of an axis-aligned cube")
+  {
+    // Cube [-3.3,4.6]^3 with quad faces: rays go through the diagonals
+    // of the faces orthogonal to x.
+    Mesh<Z3i::RealPoint> cube;
+    for(int i = 0; i < 8; i++)
+      cube.addVertex( Z3i::RealPoint( i & 1 ? 4.6 : -3.3,
+                                      i & 2 ? 4.6 : -3.3,
+                                      i & 4 ? 4.6 : -3.3 ) );
+    cube.addFace( { 0, 2, 3, 1 } );
+    cube.addFace( { 4, 5, 7, 6 } );
+    cube.addFace( { 0, 1, 5, 4 } );
+    cube.addFace( { 2, 6, 7, 3 } );
+    cube.addFace( { 0, 4, 6, 2 } );
+    cube.addFace( { 1, 3, 7, 5 } );
+    Z3i::Domain domain( Point().diagonal(-10), Point().diagonal(10));
+    MeshVoxelizer6 voxelizer;
+
+    for(unsigned int threads : { 1, 3 })
+    {
+      MeshVoxelizer6::BinaryImage nonZero(domain), evenOdd(domain);
+      voxelizer.voxelizeSolid(nonZero, cube, 1.0, MeshVoxelizer6::NON_ZERO, threads);
+      voxelizer.voxelizeSolid(evenOdd, cube, 1.0, MeshVoxelizer6::EVEN_ODD, threads);
+      REQUIRE( nonZero.count() == 512 );
+      REQUIRE( evenOdd.count() == 512 );
+      REQUIRE( nonZero( Point(-3,-3,-3) ) );
+      REQUIRE( nonZero( Point(4,4,4) ) );
+      REQUIRE( ! nonZero( Point(5,0,0) ) );
+    }
+  }
+  // ---------------------------------------------------------
+  SECTION("Solid voxelization of a OFF cube mesh")
+  {
+    Mesh<Z3i::RealPoint> inputMesh;
+    MeshReader<Z3i::RealPoint>::importOFFFile(testPath +"/samples/box.off" , inputMesh);
+    Z3i::Domain domain( Point().diagonal(-30), Point().diagonal(30));
+    MeshVoxelizer6 voxelizer;
+
+    // The cube is convex and contains the origin: a point is inside
+    // iff it is below the plane of each face.
+    unsigned int nbInside = 0;
+    for(auto p: domain)
+    {
+      bool inside = true;
+      for(unsigned int f = 0; f < inputMesh.nbFaces() && inside; f++)
+      {
+        const auto& face = inputMesh.getFace(f);
+        const Z3i::RealPoint A = inputMesh.getVertex(face[0])*10.0;
+        const Z3i::RealPoint B = inputMesh.getVertex(face[1])*10.0;
+        const Z3i::RealPoint C = inputMesh.getVertex(face[2])*10.0;
+        Z3i::RealPoint n = (B - A).crossProduct(C - A);
+        if(n.dot(A) < 0)
+          n = -n;
+        inside = n.dot(Z3i::RealPoint(p) - A) < 0;
+      }
+      if(inside)
+        nbInside++;
+    }
+    CAPTURE(nbInside);
+
+    MeshVoxelizer6::BinaryImage image(domain), imageMT(domain), evenOdd(domain);
+    voxelizer.voxelizeSolid(image, inputMesh, 10.0);
+    voxelizer.voxelizeSolid(imageMT, inputMesh, 10.0, MeshVoxelizer6::NON_ZERO, 4);
+    voxelizer.voxelizeSolid(evenOdd, inputMesh, 10.0, MeshVoxelizer6::EVEN_ODD, 0);
+    REQUIRE( image.count() == nbInside );
+    REQUIRE( std::equal( image.begin(), image.end(), imageMT.begin() ) );
+    REQUIRE( std::equal( image.begin(), image.end(), evenOdd.begin() ) );
+
+    // Without one of its faces, the rows through the hole are not filled.
+    Mesh<Z3i::RealPoint> openMesh;
+    for(unsigned int i = 0; i < inputMesh.nbVertex(); i++)
+      openMesh.addVertex( inputMesh.getVertex(i) );
+    for(unsigned int f = 0; f < inputMesh.nbFaces(); f++)
+      if(f != 1)
+        openMesh.addFace( inputMesh.getFace(f) );
+    MeshVoxelizer6::BinaryImage openImage(domain);
+    voxelizer.voxelizeSolid(openImage, openMesh, 10.0, MeshVoxelizer6::NON_ZERO, 2);
+    REQUIRE( openImage.count() > 0 );
+    REQUIRE( openImage.count() < image.count() );
+    unsigned int nbOutside = 0;
+    for(auto p: domain)
+      if(openImage(p) && ! image(p))
+        nbOutside++;
+    REQUIRE( nbOutside == 0 );
+  }
 }
@@ -271,6 +271,30 @@ SCENARIO( "SurfaceMesh< RealPoint3 > mesh helper tests", "[surfmesh][helper]" )
   }
 }
 
+SCENARIO( "SurfaceMesh< RealPoint3 > multi-threaded build tests", "[surfmesh][build][threads]" )
+{
+  typedef PointVector<3,double>                      RealPoint;
+  typedef PointVector<3,double>                      RealVector;
+  typedef SurfaceMesh< RealPoint, RealVector >       PolygonMesh;
+  typedef SurfaceMeshHelper< RealPoint, RealVector > PolygonMeshHelper;
+  typedef PolygonMeshHelper::NormalsType             NormalsType;
+  GIVEN( "A torus with radii 3 and 1, rebuilt with 4 threads" ) {
+    auto polymesh = PolygonMeshHelper::makeTorus( 3.0, 1.0, RealPoint::zero,
+                                                  100, 100, 0, NormalsType::NO_NORMALS );
+    PolygonMesh polymesh4( polymesh.positions().cbegin(), polymesh.positions().cend(),
+                           polymesh.allIncidentVertices().cbegin(),
+                           polymesh.allIncidentVertices().cend(), 4 );
+    THEN( "Both meshes have the same edges and neighborhoods" ) {
+      REQUIRE( polymesh4.nbEdges() == polymesh.nbEdges() );
+      REQUIRE( polymesh4.allEdgeVertices()     == polymesh.allEdgeVertices() );
+      REQUIRE( polymesh4.allEdgeLeftFaces()    == polymesh.allEdgeLeftFaces() );
+      REQUIRE( polymesh4.allEdgeRightFaces()   == polymesh.allEdgeRightFaces() );
+      REQUIRE( polymesh4.allNeighborVertices() == polymesh.allNeighborVertices() );
+      REQUIRE( polymesh4.allNeighborFaces()    == polymesh.allNeighborFaces() );
+    }
+  }
+}
+
 SCENARIO( "SurfaceMesh< RealPoint3 > reader/writer tests", "[surfmesh][io]" )
 {
   typedef PointVector<3,double>                      RealPoint;
@@ -0,0 +1,165 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCellHashMap.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class CellHashMap.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <map>
+#include <random>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CSTLAssociativeContainer.h"
+#include "DGtal/base/ParallelFor.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/CellHashMap.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class CellHashMap.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing CellHashMap" )
+{
+  typedef Z3i::KSpace                          KSpace;
+  typedef KSpace::SCell                        SCell;
+  typedef KSpace::Cell                         Cell;
+  typedef Z3i::Point                           Point;
+  typedef CellHashMap< SCell, double >         Map;
+  BOOST_CONCEPT_ASSERT(( concepts::CSTLAssociativeContainer< Map > ));
+  BOOST_CONCEPT_ASSERT(( concepts::CSTLAssociativeContainer< CellHashMap< Cell, int > > ));
+
+  KSpace K;
+  K.init( Point( -20, -20, -20 ), Point( 20, 20, 20 ), true );
+  std::mt19937 gen( 3 );
+  std::uniform_int_distribution< int > coord( -41, 41 );
+  std::vector< SCell > cells;
+  for ( int i = 0; i < 5000; ++i )
+    cells.push_back( K.sCell( Point( coord( gen ), coord( gen ), coord( gen ) ),
+                              i % 2 == 0 ? KSpace::POS : KSpace::NEG ) );
+
+  SECTION( "Same behaviour as std::map" )
+    {
+      Map map;
+      std::map< SCell, double > ref;
+      REQUIRE( map.empty() );
+      REQUIRE( map.find( cells[ 0 ] ) == map.end() );
+      for ( std::size_t i = 0; i < cells.size(); ++i )
+        {
+          const bool inserted = map.insert( std::make_pair( cells[ i ], (double) i ) ).second;
+          REQUIRE( inserted == ref.insert( std::make_pair( cells[ i ], (double) i ) ).second );
+        }
+      REQUIRE( map.size() == ref.size() );
+      REQUIRE( map.isValid() );
+      for ( const auto & p : ref )
+        {
+          REQUIRE( map.count( p.first ) == 1 );
+          REQUIRE( map.find( p.first )->second == p.second );
+        }
+      std::size_t n = 0;
+      for ( auto it = map.begin(); it != map.end(); ++it, ++n )
+        REQUIRE( ref[ it->first ] == it->second );
+      REQUIRE( n == ref.size() );
+      // Erases one cell out of three, checking the others are still found.
+      std::size_t i = 0;
+      for ( auto it = ref.begin(); it != ref.end(); ++i )
+        if ( i % 3 == 0 )
+          {
+            REQUIRE( map.erase( it->first ) == 1 );
+            it = ref.erase( it );
+          }
+        else ++it;
+      REQUIRE( map.size() == ref.size() );
+      for ( const SCell & c : cells )
+        {
+          REQUIRE( map.count( c ) == ref.count( c ) );
+          if ( ref.count( c ) ) REQUIRE( map.find( c )->second == ref[ c ] );
+        }
+      map[ cells[ 0 ] ] += 1.0;
+      ref[ cells[ 0 ] ] += 1.0;
+      REQUIRE( map.find( cells[ 0 ] )->second == ref[ cells[ 0 ] ] );
+      Map copy( map );
+      map.erase( map.begin(), map.end() );
+      REQUIRE( map.empty() );
+      REQUIRE( copy.size() == ref.size() );
+      map = copy;
+      REQUIRE( map.size() == ref.size() );
+      map.clear();
+      REQUIRE( map.empty() );
+      REQUIRE( map.begin() == map.end() );
+    }
+
+  SECTION( "Sign and non packable cells" )
+    {
+      const SCell s = cells[ 0 ];
+      REQUIRE( Map::pack( s ) != Map::pack( K.sOpp( s ) ) );
+      Map map;
+      map[ s ] = 1.0;
+      REQUIRE( map.count( K.sOpp( s ) ) == 0 );
+      // Cells that differ by 2^20 have the same packed word, but are distinct.
+      typedef CellHashMap< KSpace::SPreCell, double > PreMap;
+      const KSpace::SPreCell p = s.preCell();
+      KSpace::SPreCell far = p;
+      far.coordinates[ 0 ] += 1 << 20;
+      REQUIRE( PreMap::isPackable( p ) );
+      REQUIRE( ! PreMap::isPackable( far ) );
+      REQUIRE( PreMap::pack( far ) == PreMap::pack( p ) );
+      PreMap premap;
+      premap[ p ]   = 1.0;
+      premap[ far ] = 2.0;
+      REQUIRE( premap.size() == 2 );
+      REQUIRE( premap.find( p )->second == 1.0 );
+      REQUIRE( premap.find( far )->second == 2.0 );
+    }
+
+  SECTION( "Concurrent insertions" )
+    {
+      Map serial;
+      for ( std::size_t i = 0; i < cells.size(); ++i )
+        serial.insert( std::make_pair( cells[ i ], (double) i ) );
+      Map map;
+      map.reserve( cells.size() );
+      std::vector< int > inserted( 4, 0 );
+      functions::parallelFor
+        ( cells.size(), 4,
+          [&] ( unsigned int chunk, std::size_t b, std::size_t e )
+          {
+            for ( std::size_t i = b; i < e; ++i )
+              if ( map.concurrentInsert( std::make_pair( cells[ i ], (double) i ) ) )
+                ++inserted[ chunk ];
+          } );
+      REQUIRE( map.size() == serial.size() );
+      REQUIRE( inserted[ 0 ] + inserted[ 1 ] + inserted[ 2 ] + inserted[ 3 ] == (int) serial.size() );
+      for ( const auto & p : serial )
+        REQUIRE( map.count( p.first ) == 1 );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
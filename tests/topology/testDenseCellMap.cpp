@@ -0,0 +1,223 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDenseCellMap.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class DenseCellMap.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <map>
+#include <unordered_set>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/DenseCellMap.h"
+#include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/topology/CubicalComplexFunctions.h"
+#include "DGtal/topology/VoxelComplex.h"
+#include "DGtal/topology/VoxelComplexFunctions.h"
+#include "DGtal/topology/NeighborhoodConfigurations.h"
+#include "DGtal/topology/tables/NeighborhoodTables.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DenseCellMap.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing DenseCellMap" )
+{
+  typedef Z2i::KSpace                        KSpace;
+  typedef KSpace::Cell                       Cell;
+  typedef Z2i::Point                         Point;
+  typedef DenseCellMap< KSpace, int >        Map;
+
+  KSpace K;
+  K.init( Point( -3, -2 ), Point( 4, 5 ), true );
+  const Point lowK = K.uKCoords( K.lowerCell() );
+  const Point upK  = K.uKCoords( K.upperCell() );
+
+  SECTION( "Each cell of a given dimension has its own index" )
+    {
+      for ( Dimension d = 0; d <= 3; ++d )
+        {
+          Map map( K, d );
+          std::set< Map::Size > indices;
+          Map::Size nb = 0;
+          for ( auto kp : Z2i::Domain( lowK, upK ) )
+            {
+              const Cell c = K.uCell( kp );
+              if ( d <= 2 && K.uDim( c ) != d )
+                {
+                  REQUIRE( ! map.isStorable( c ) );
+                  continue;
+                }
+              REQUIRE( map.isStorable( c ) );
+              const auto idx = map.index( c );
+              REQUIRE( idx < map.capacity() );
+              REQUIRE( map.cellAt( idx ) == c );
+              indices.insert( idx );
+              ++nb;
+            }
+          REQUIRE( indices.size() == nb );
+          REQUIRE( nb <= map.capacity() );
+        }
+      Map map( K, 1 );
+      REQUIRE( ! map.isStorable( K.uCell( Point( 20, 1 ) ) ) );
+    }
+
+  SECTION( "The map behaves like an associative container" )
+    {
+      Map map( K, 1 );
+      std::map< Cell, int > ref;
+      REQUIRE( map.empty() );
+      for ( auto kp : Z2i::Domain( lowK, upK ) )
+        {
+          const Cell c = K.uCell( kp );
+          if ( K.uDim( c ) == 1 && ( kp[ 0 ] + 3 * kp[ 1 ] ) % 5 == 0 )
+            {
+              ref[ c ] = kp[ 0 ];
+              map[ c ] = kp[ 0 ];
+            }
+        }
+      REQUIRE( map.size() == ref.size() );
+      auto res = map.insert( std::make_pair( ref.begin()->first, 100 ) );
+      REQUIRE( ! res.second );
+      REQUIRE( res.first->second == ref.begin()->second );
+      res = map.insert( std::make_pair( K.uCell( Point( 20, 1 ) ), 100 ) );
+      REQUIRE( res.first == map.end() );
+      REQUIRE( ! res.second );
+      Map::Size nb = 0;
+      for ( auto it = map.begin(), itE = map.end(); it != itE; ++it, ++nb )
+        {
+          REQUIRE( ref.count( it->first ) == 1 );
+          REQUIRE( ref[ it->first ] == it->second );
+        }
+      REQUIRE( nb == ref.size() );
+      for ( const auto & v : ref )
+        {
+          REQUIRE( map.count( v.first ) == 1 );
+          REQUIRE( map.find( v.first )->second == v.second );
+        }
+      // Erase one cell out of two while iterating.
+      bool odd = false;
+      for ( auto it = map.begin(), itE = map.end(); it != itE; )
+        {
+          auto itNext = it; ++itNext;
+          if ( odd ) { ref.erase( it->first ); map.erase( it ); }
+          odd = ! odd;
+          it = itNext;
+        }
+      REQUIRE( map.size() == ref.size() );
+      for ( const auto & v : ref ) REQUIRE( map.count( v.first ) == 1 );
+      REQUIRE( map.erase( ref.begin()->first ) == 1 );
+      REQUIRE( map.erase( ref.begin()->first ) == 0 );
+      const Map copy( map );
+      REQUIRE( copy.size() == map.size() );
+      REQUIRE( copy.equal_range( std::next( ref.begin() )->first ).first != copy.end() );
+      map.clear();
+      REQUIRE( map.empty() );
+      REQUIRE( map.begin() == map.end() );
+    }
+}
+
+TEST_CASE( "CubicalComplex and VoxelComplex with DenseCellMap" )
+{
+  typedef Z3i::KSpace                                 KSpace;
+  typedef KSpace::Cell                                Cell;
+  typedef Z3i::Point                                  Point;
+  typedef DenseCellMap< KSpace, CubicalCellData >     Map;
+  typedef CubicalComplex< KSpace, Map >               CC;
+  typedef CubicalComplex< KSpace >                    RefCC;
+
+  KSpace K;
+  K.init( Point( -2, -2, -2 ), Point( 6, 6, 6 ), true );
+
+  SECTION( "Same complexes as with std::map" )
+    {
+      CC complex( K );
+      RefCC ref( K );
+      std::vector< Cell > S;
+      for ( auto p : Z3i::Domain( Point( 0, 0, 0 ), Point( 4, 3, 2 ) ) )
+        if ( ( p[ 0 ] + p[ 1 ] + p[ 2 ] ) % 4 != 0 )
+          {
+            S.push_back( K.uSpel( p ) );
+            complex.insertCell( S.back() );
+            ref.insertCell( S.back() );
+          }
+      complex.close();
+      ref.close();
+      for ( Dimension d = 0; d <= 3; ++d )
+        REQUIRE( complex.nbCells( d ) == ref.nbCells( d ) );
+      REQUIRE( complex.euler() == ref.euler() );
+      for ( auto it = ref.begin(), itE = ref.end(); it != itE; ++it )
+        REQUIRE( complex.belongs( *it ) );
+      CC I = complex.interior();
+      CC B = complex.boundary();
+      REQUIRE( I.size() == ref.interior().size() );
+      REQUIRE( B.size() == ref.boundary().size() );
+      REQUIRE( ( I | B ) == complex );
+      REQUIRE( ( complex - B ) == I );
+      REQUIRE( I <= complex );
+
+      // Collapse keeps the topology.
+      auto it1 = complex.findCell( 0, K.uCell( Point( 2, 2, 2 ) ) );
+      REQUIRE( it1 != complex.end( 0 ) );
+      it1->second.data |= CC::FIXED;
+      ref.findCell( 0, K.uCell( Point( 2, 2, 2 ) ) )->second.data |= RefCC::FIXED;
+      CC::DefaultCellMapIteratorPriority P;
+      RefCC::DefaultCellMapIteratorPriority RefP;
+      const auto euler = complex.euler();
+      functions::collapse( complex, S.begin(), S.end(), P, false, true );
+      functions::collapse( ref, S.begin(), S.end(), RefP, false, true );
+      REQUIRE( complex.euler() == euler );
+      for ( Dimension d = 0; d <= 3; ++d )
+        REQUIRE( complex.nbCells( d ) == ref.nbCells( d ) );
+    }
+
+  SECTION( "Thinning a VoxelComplex" )
+    {
+      typedef VoxelComplex< KSpace, Map > VC;
+      Z3i::DigitalSet ball( Z3i::Domain( Point( -2, -2, -2 ), Point( 6, 6, 6 ) ) );
+      for ( auto p : ball.domain() )
+        if ( ( p - Point( 2, 2, 2 ) ).norm() <= 3.5 ) ball.insertNew( p );
+      VC vc( K );
+      vc.construct( ball, functions::loadTable( simplicity::tableSimple26_6 ) );
+      REQUIRE( vc.nbCells( 3 ) == ball.size() );
+      REQUIRE( vc.euler() == 1 );
+      typedef VoxelComplex< KSpace > RefVC;
+      RefVC refvc( K );
+      refvc.construct( ball, functions::loadTable( simplicity::tableSimple26_6 ) );
+      auto thin = functions::asymetricThinningScheme< VC >
+        ( vc, functions::selectFirst< VC >, functions::skelUltimate< VC > );
+      auto refthin = functions::asymetricThinningScheme< RefVC >
+        ( refvc, functions::selectFirst< RefVC >, functions::skelUltimate< RefVC > );
+      REQUIRE( thin.nbCells( 3 ) == refthin.nbCells( 3 ) );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
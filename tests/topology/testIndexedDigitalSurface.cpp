@@ -38,6 +38,7 @@
 #include "DGtal/graph/CUndirectedSimpleGraph.h"
 #include "DGtal/graph/BreadthFirstVisitor.h"
 #include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/DigitalSurface.h"
 #include "DGtal/topology/IndexedDigitalSurface.h"
 #include "DGtal/shapes/Shapes.h"
 ///////////////////////////////////////////////////////////////////////////////
@@ -93,6 +94,22 @@ SCENARIO( "IndexedDigitalSurface< DigitalSetBoundary > build tests", "[idxdsurf]
       REQUIRE( K.sOpp( dsurf.linel( 112 ) ) == dsurf.linel( dsurf.opposite( 112 ) ) );
       REQUIRE( K.sOpp( dsurf.linel( 200 ) ) == dsurf.linel( dsurf.opposite( 200 ) ) );
     }
+    THEN( "Surfels, linels and pointels give back their vertex, arc and face" ) {
+      bool vtx_ok = true;
+      for ( DigSurface::Vertex v = 0; v < dsurf.nbVertices(); ++v )
+        vtx_ok = vtx_ok && dsurf.getVertex( dsurf.surfel( v ) ) == v;
+      bool arc_ok = true;
+      for ( DigSurface::Arc a = 0; a < dsurf.nbArcs(); ++a )
+        arc_ok = arc_ok && dsurf.getArc( dsurf.linel( a ) ) == a;
+      bool face_ok = true;
+      for ( DigSurface::Face f = 0; f < dsurf.nbFaces(); ++f )
+        face_ok = face_ok && dsurf.getFace( dsurf.pointel( f ) ) == f;
+      REQUIRE( vtx_ok );
+      REQUIRE( arc_ok );
+      REQUIRE( face_ok );
+      const DigSurface::Vertex invalid = DigSurface::INVALID_FACE;
+      REQUIRE( dsurf.getVertex( K.sCell( Point( 0, 0, 0 ) ) ) == invalid );
+    }
     THEN( "Breadth-first visiting the digital surface from vertex 0 goes to a distance 13." ) {
       BreadthFirstVisitor< DigSurface > visitor( dsurf, 0 );
       std::vector<int> vertices;
@@ -110,6 +127,63 @@ SCENARIO( "IndexedDigitalSurface< DigitalSetBoundary > build tests", "[idxdsurf]
   }
 }
 
+SCENARIO( "IndexedDigitalSurface< DigitalSetBoundary > and DigitalSurface tests", "[idxdsurf][build][dsurf]" )
+{
+  typedef DigitalSetBoundary< KSpace, DigitalSet > DigitalSurfaceContainer;
+  typedef IndexedDigitalSurface< DigitalSurfaceContainer > DigSurface;
+  typedef DigitalSurface< DigitalSurfaceContainer > RefSurface;
+  Point p1( -25, -25, -25 );
+  Point p2(  25,  25,  25 );
+  KSpace K;
+  K.init( p1, p2, true );
+  DigitalSet aSet( Domain( p1, p2 ) );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 0, 0, 0 ), 20 );
+  Shapes<Domain>::removeNorm2Ball( aSet, Point( 0, 0, 0 ), 12 );
+  DigitalSurfaceContainer container( K, aSet );
+  RefSurface ref( container );
+  DigSurface dsurf;
+  bool build_ok = dsurf.build( container );
+  GIVEN( "A digital set boundary over a hollow ball of radii 20 and 12" ) {
+    THEN( "Vertices and faces are those of the DigitalSurface, in the same order" ) {
+      REQUIRE( build_ok == true );
+      REQUIRE( dsurf.nbVertices() == ref.size() );
+      REQUIRE( dsurf.Euler() == 4 );
+      bool vtx_ok = true;
+      DigSurface::Vertex v = 0;
+      for ( auto && s : ref )
+        vtx_ok = vtx_ok && dsurf.surfel( v++ ) == s;
+      REQUIRE( vtx_ok );
+      const RefSurface::FaceSet faces = ref.allClosedFaces();
+      REQUIRE( dsurf.nbFaces() == faces.size() );
+      bool face_ok = true;
+      DigSurface::Face f = 0;
+      for ( auto && face : faces )
+        face_ok = face_ok && dsurf.pointel( f++ ) == ref.pivot( face );
+      REQUIRE( face_ok );
+    }
+    THEN( "Linels of arcs are the separators of the DigitalSurface arcs" ) {
+      bool arc_ok = true;
+      for ( DigSurface::Arc a = 0; a < dsurf.nbArcs(); ++a )
+        {
+          const RefSurface::Arc ra = ref.arc( dsurf.surfel( dsurf.tail( a ) ),
+                                              dsurf.surfel( dsurf.head( a ) ) );
+          arc_ok = arc_ok && dsurf.linel( a ) == ref.separator( ra )
+            && dsurf.getArc( dsurf.linel( a ) ) == a;
+        }
+      REQUIRE( arc_ok );
+    }
+    THEN( "Cells not on the surface, or with the other orientation, are invalid" ) {
+      const DigSurface::Vertex invalid = DigSurface::INVALID_FACE;
+      bool opp_ok = true;
+      for ( DigSurface::Vertex v = 0; v < dsurf.nbVertices(); ++v )
+        opp_ok = opp_ok && dsurf.getVertex( K.sOpp( dsurf.surfel( v ) ) ) == invalid;
+      REQUIRE( opp_ok );
+      REQUIRE( dsurf.getVertex( K.sCell( Point( 1, 1, 1 ) ) ) == invalid );
+      REQUIRE( dsurf.getFace( K.sPointel( Point( 0, 0, 0 ) ) ) == invalid );
+    }
+  }
+}
+
 SCENARIO( "IndexedDigitalSurface< RealPoint3 > concept check tests", "[idxdsurf][concepts]" )
 {
   typedef DigitalSetBoundary< KSpace, DigitalSet > DigitalSurfaceContainer;
@@ -0,0 +1,135 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testLinearizedCellIndex.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class LinearizedCellIndex.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <map>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/LinearizedCellIndex.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class LinearizedCellIndex.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing LinearizedCellIndex" )
+{
+  typedef Z3i::KSpace                        KSpace;
+  typedef KSpace::Cell                       Cell;
+  typedef KSpace::SCell                      SCell;
+  typedef Z3i::Point                         Point;
+  typedef LinearizedCellIndex< KSpace >      CellIndex;
+  typedef CellIndex::Index                   Index;
+
+  KSpace K;
+  K.init( Point( -5, -5, -5 ), Point( 5, 5, 5 ), true );
+  // A box of Khalimsky coordinates whose extents are not multiple of
+  // the page width.
+  const Point lowK( -7, -2, 3 );
+  const Point upK ( 6, 9, 4 );
+
+  SECTION( "An object not initialized has no index" )
+    {
+      CellIndex index;
+      REQUIRE( ! index.isValid() );
+      REQUIRE( index.get( K.uCell( Point( 0, 0, 0 ) ) ) == CellIndex::INVALID_INDEX );
+      REQUIRE( index.nbPages() == 0 );
+    }
+
+  SECTION( "Every cell of the box keeps its own index" )
+    {
+      CellIndex index( K, lowK, upK );
+      REQUIRE( index.isValid() );
+      REQUIRE( index.nbPages() == 0 );
+      std::map< Cell, Index > ref;
+      Index i = 0;
+      for ( auto x = lowK[ 0 ]; x <= upK[ 0 ]; ++x )
+        for ( auto y = lowK[ 1 ]; y <= upK[ 1 ]; ++y )
+          for ( auto z = lowK[ 2 ]; z <= upK[ 2 ]; ++z )
+            {
+              const Cell c = K.uCell( Point( x, y, z ) );
+              REQUIRE( index.get( c ) == CellIndex::INVALID_INDEX );
+              if ( ( x + y + z ) % 3 != 0 ) continue;
+              index.set( c, i );
+              ref[ c ] = i++;
+            }
+      unsigned int nb_ok = 0;
+      for ( auto&& p : ref ) nb_ok += index.get( p.first ) == p.second ? 1 : 0;
+      REQUIRE( nb_ok == ref.size() );
+      // 14x12x2 coordinates span 4x3x1 pages.
+      REQUIRE( index.nbPages() == 12 );
+      REQUIRE( index.get( K.uCell( Point( -6, -2, 4 ) ) ) == CellIndex::INVALID_INDEX );
+      // Overwriting does not allocate.
+      const Cell c = K.uCell( Point( -7, -2, 4 ) );
+      index.set( c, 1000 );
+      REQUIRE( index.get( c ) == 1000 );
+      REQUIRE( index.nbPages() == 12 );
+    }
+
+  SECTION( "Pages are allocated only where cells are set" )
+    {
+      CellIndex index( K, lowK, upK );
+      const Cell c = K.uCell( Point( 5, 8, 3 ) );
+      index.set( c, 7 );
+      REQUIRE( index.nbPages() == 1 );
+      REQUIRE( index.get( c ) == 7 );
+      REQUIRE( index.get( K.uCell( Point( -7, -2, 3 ) ) ) == CellIndex::INVALID_INDEX );
+    }
+
+  SECTION( "Cells out of the box have no index" )
+    {
+      CellIndex index( K, lowK, upK );
+      index.set( K.uCell( lowK ), 1 );
+      index.set( K.uCell( upK ), 2 );
+      REQUIRE( index.isInside( lowK ) );
+      REQUIRE( index.isInside( upK ) );
+      REQUIRE( ! index.isInside( lowK - Point( 1, 0, 0 ) ) );
+      REQUIRE( ! index.isInside( upK + Point( 0, 0, 1 ) ) );
+      REQUIRE( index.get( K.uCell( lowK - Point( 0, 1, 0 ) ) ) == CellIndex::INVALID_INDEX );
+      REQUIRE( index.get( K.uCell( upK + Point( 1, 0, 0 ) ) ) == CellIndex::INVALID_INDEX );
+      index.clear();
+      REQUIRE( ! index.isValid() );
+      REQUIRE( index.get( K.uCell( lowK ) ) == CellIndex::INVALID_INDEX );
+    }
+
+  SECTION( "Signed cells share the entry of their unsigned cell" )
+    {
+      CellIndex index( K, lowK, upK );
+      const SCell s = K.sCell( Point( 1, 2, 3 ), K.POS );
+      index.set( s, 3 );
+      REQUIRE( index.get( s ) == 3 );
+      REQUIRE( index.get( K.sOpp( s ) ) == 3 );
+      REQUIRE( index.get( K.unsigns( s ) ) == 3 );
+    }
+}
+
+/** @ingroup Tests **/
@@ -812,6 +812,64 @@ bool testSetTable()
   return nbok == nb;
 
 }
+bool testOccupancyMasks()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef Z3i::Point Point;
+  typedef Z3i::Domain Domain;
+  typedef Z3i::DigitalSet DigitalSet;
+  typedef Z3i::Object26_6 Object26_6;
+  Domain domain( Point( -6, -6, -6 ), Point( 6, 6, 6 ) );
+  DigitalSet ball_set( domain );
+  for ( auto p : domain )
+    if ( p.norm() <= 5.0 && p[ 0 ] != 0 ) ball_set.insertNew( p );
+  auto table = functions::loadTable( simplicity::tableSimple26_6 );
+  Object26_6 shape( Z3i::dt26_6, ball_set );
+  Object26_6 shape2( Z3i::dt26_6, ball_set );
+  shape.setTable( table );
+  shape2.setTable( table );
+
+  trace.beginBlock ( "Occupancy masks ..." );
+  shape2.enableOccupancyMasks();
+  INBLOCK_TEST( shape2.hasOccupancyMasks() && ! shape.hasOccupancyMasks() );
+  bool same = true;
+  for ( auto p : domain )
+    same = same && shape.neighborhoodConfiguration( p )
+      == shape2.neighborhoodConfiguration( p );
+  INBLOCK_TEST( same );
+  trace.endBlock();
+
+  // Greedy thinning in the same order with and without masks.
+  trace.beginBlock ( "Greedy homotopic thinning with occupancy masks ..." );
+  std::vector< Point > points( ball_set.begin(), ball_set.end() );
+  std::sort( points.begin(), points.end() );
+  DGtal::uint64_t nb_simple;
+  do {
+    nb_simple = 0;
+    for ( const auto & p : points )
+      {
+        const bool simple = shape.pointSet()( p ) && shape.isSimple( p );
+        const bool simple2 = shape2.pointSet()( p ) && shape2.isSimple( p );
+        same = same && simple == simple2;
+        if ( simple )  shape.erase( p );
+        if ( simple2 ) { shape2.erase( p ); ++nb_simple; }
+      }
+  } while ( nb_simple != 0 );
+  INBLOCK_TEST( same );
+  INBLOCK_TEST( shape.size() == 2 && shape2.size() == 2 );
+  shape2.insert( Point( 0, 0, 0 ) );
+  same = true;
+  for ( auto p : domain )
+    same = same && shape2.neighborhoodConfiguration( p )
+      == shape2.getNeighborhoodConfigurationOccupancy
+         ( p, *functions::mapZeroPointNeighborhoodToConfigurationMask<Point>() );
+  INBLOCK_TEST( same );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -828,7 +886,8 @@ int main( int argc, char** argv )
     && testSimplePoints3D()
     && testSimplePoints2D()
     && testObjectGraph()
-    && testSetTable();
+    && testSetTable()
+    && testOccupancyMasks();
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
@@ -0,0 +1,150 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedKhalimskySpaceND.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class PackedKhalimskySpaceND.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <unordered_set>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/PackedKhalimskySpaceND.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef PackedKhalimskySpaceND< 3, DGtal::int32_t > PKSpace;
+typedef Z3i::KSpace                                  KSpace;
+typedef Z3i::Point                                   Point;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PackedKhalimskySpaceND.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing PackedKhalimskySpaceND" )
+{
+  BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< PKSpace > ));
+
+  SECTION( "Packed cells are smaller and convert back" )
+    {
+      REQUIRE( sizeof( PKSpace::Cell )  == 8 );
+      REQUIRE( sizeof( PKSpace::SCell ) == 8 );
+      REQUIRE( sizeof( PKSpace::SCell ) < sizeof( KSpace::SCell ) );
+      REQUIRE( PKSpace::Cell::bitsPerCoordinate == 21 );
+      REQUIRE( PackedKhalimskySpaceND< 2 >::Cell::bitsPerCoordinate == 31 );
+
+      PKSpace PK;
+      REQUIRE( PK.init( Point( -1000, -3, -500000 ), Point( 10, 20000, 5 ), true ) );
+      REQUIRE( ! PK.init( Point( -600000, 0, 0 ), Point( 10, 20, 5 ), true ) );
+      REQUIRE( ! PK.init( Point( 0, 0, 0 ), Point( 10, 600000, 5 ), true ) );
+      REQUIRE( PK.init( Point( -5, -4, -3 ), Point( 3, 4, 5 ), true ) );
+      KSpace K;
+      K.init( PK.lowerBound(), PK.upperBound(), true );
+
+      // Same cells, same order.
+      std::set< KSpace::SCell > full;
+      PKSpace::SCellSet packed;
+      for ( auto kp : Z3i::Domain( K.lowerCell().preCell().coordinates,
+                                   K.upperCell().preCell().coordinates ) )
+        for ( bool sign : { true, false } )
+          {
+            const KSpace::SCell c = K.sCell( kp, sign );
+            const PKSpace::SCell pc = c;
+            REQUIRE( pc.cell() == c );
+            REQUIRE( PK.sKCoords( pc ) == kp );
+            REQUIRE( PK.sSign( pc ) == sign );
+            full.insert( c );
+            packed.insert( pc );
+          }
+      REQUIRE( full.size() == packed.size() );
+      REQUIRE( std::equal( full.begin(), full.end(), packed.begin(),
+                           [] ( const KSpace::SCell & c, const PKSpace::SCell & pc )
+                           { return c == pc.cell(); } ) );
+      const PKSpace::Cell uc = PK.uCell( Point( -9, 7, 11 ) );
+      REQUIRE( PK.uKCoords( uc ) == Point( -9, 7, 11 ) );
+      REQUIRE( PK.uDim( uc ) == 3 );
+      REQUIRE( PK.uDim( PK.uCell( Point( -8, 7, 11 ) ) ) == 2 );
+      PKSpace::Cell vc = uc;
+      PK.uSetKCoord( vc, 1, 4 );
+      REQUIRE( PK.uKCoords( vc ) == Point( -9, 4, 11 ) );
+      REQUIRE( PK.uLowerIncident( vc ).size() == 4 );
+      REQUIRE( PackedKhalimskySpaceND< 3, DGtal::int32_t, DGtal::uint32_t >::Cell::unpack
+               ( PackedKhalimskySpaceND< 3, DGtal::int32_t, DGtal::uint32_t >::Cell::pack( Point( -9, 7, 11 ) ) )
+               == Point( -9, 7, 11 ) );
+    }
+
+  SECTION( "Trackers and digital surfaces work with packed cells" )
+    {
+      const Point lo( -10, -10, -10 ), up( 10, 10, 10 );
+      Z3i::DigitalSet ball( Z3i::Domain( lo, up ) );
+      for ( auto p : ball.domain() )
+        if ( p.norm() <= 6.5 ) ball.insertNew( p );
+      KSpace K;
+      PKSpace PK;
+      REQUIRE( K.init( lo, up, true ) );
+      REQUIRE( PK.init( lo, up, true ) );
+      SurfelAdjacency< 3 > adj( true );
+
+      KSpace::SCellSet surface;
+      Surfaces< KSpace >::trackBoundary
+        ( surface, K, adj, ball, Surfaces< KSpace >::findABel( K, ball, 10000 ) );
+      PKSpace::SCellSet psurface;
+      Surfaces< PKSpace >::trackBoundary
+        ( psurface, PK, adj, ball, Surfaces< PKSpace >::findABel( PK, ball, 10000 ) );
+      REQUIRE( surface.size() > 0 );
+      REQUIRE( surface.size() == psurface.size() );
+      bool same = true;
+      for ( const auto & s : psurface ) same = same && surface.count( s.cell() ) == 1;
+      REQUIRE( same );
+
+      PKSpace::SCellSet pboundary;
+      Surfaces< PKSpace >::sMakeBoundary( pboundary, PK, ball, lo, up );
+      REQUIRE( pboundary == psurface );
+
+      std::unordered_set< PKSpace::SCell > hashed( psurface.begin(), psurface.end() );
+      REQUIRE( hashed.size() == psurface.size() );
+
+      typedef SetOfSurfels< PKSpace, PKSpace::SurfelSet > SurfaceContainer;
+      DigitalSurface< SurfaceContainer > dsurf( new SurfaceContainer( PK, adj, psurface ) );
+      int nbEdges = 0;
+      for ( auto v : dsurf ) nbEdges += dsurf.degree( v );
+      const int euler = (int) dsurf.size() - nbEdges / 2
+        + (int) dsurf.allClosedFaces().size();
+      REQUIRE( dsurf.size() == surface.size() );
+      REQUIRE( euler == 2 );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,154 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSurfacesBitBoundary.cpp
+ * @ingroup Tests
+ * @date 2026/10/16
+ *
+ * Functions for testing the word-parallel boundary extraction of
+ * Surfaces on binary images stored with one bit per point.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerByBits.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing Surfaces::sMakeBoundary on ImageContainerByBits.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Point predicate reading an image through its operator(), so that
+ * the generic (point by point) boundary extraction is used.
+ */
+template <typename TImage>
+struct PointByPoint
+{
+  typedef typename TImage::Point Point;
+  const TImage* image;
+  bool operator()( const Point & p ) const { return (*image)( p ); }
+};
+
+/**
+ * Compares the word-parallel extraction to the generic one, within
+ * the bounds @a low and @a up.
+ */
+template <typename KSpace, typename Image>
+bool compareBoundaries( const KSpace & K, const Image & image,
+                        const typename KSpace::Point & low,
+                        const typename KSpace::Point & up )
+{
+  typedef typename KSpace::SCell SCell;
+  typedef typename KSpace::Cell  Cell;
+  PointByPoint<Image> pp = { &image };
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  std::set<SCell> ref, bits, bits4;
+  Surfaces<KSpace>::sMakeBoundary( ref, K, pp, low, up );
+  Surfaces<KSpace>::sMakeBoundary( bits, K, image, low, up );
+  Surfaces<KSpace>::sMakeBoundary( bits4, K, image, low, up, 4 );
+  trace.info() << "#ref=" << ref.size() << " #bits=" << bits.size()
+               << " #bits(4 threads)=" << bits4.size() << std::endl;
+  nbok += ( ! ref.empty() && ref == bits && ref == bits4 ) ? 1 : 0;
+  nb++;
+
+  std::set<Cell> uref, ubits;
+  Surfaces<KSpace>::uMakeBoundary( uref, K, pp, low, up );
+  Surfaces<KSpace>::uMakeBoundary( ubits, K, image, low, up, 3 );
+  nbok += ( uref == ubits ) ? 1 : 0;
+  nb++;
+
+  // The written order does not depend on the number of threads.
+  std::vector<SCell> v1, v3;
+  std::back_insert_iterator< std::vector<SCell> > out1( v1 ), out3( v3 );
+  Surfaces<KSpace>::sWriteBitBoundary( out1, K, image, low, up, 1 );
+  Surfaces<KSpace>::sWriteBitBoundary( out3, K, image, low, up, 3 );
+  nbok += ( v1 == v3 && v1.size() == ref.size() ) ? 1 : 0;
+  nb++;
+
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  return nbok == nb;
+}
+
+bool testBitBoundary3D()
+{
+  typedef ImageContainerByBits<Z3i::Domain> Image;
+  trace.beginBlock ( "Testing word-parallel boundary in 3D ..." );
+  // Rows of 139 points, i.e. three words.
+  const Z3i::Point lower( -70, -9, -8 ), upper( 68, 10, 9 );
+  Z3i::KSpace K;
+  K.init( lower, upper, true );
+  Image image( Z3i::Domain( lower, upper ) );
+  for ( auto&& p : image.domain() )
+    {
+      const Z3i::Point q( p[ 0 ] / 6, p[ 1 ], p[ 2 ] );
+      image.setValue( p, q.norm() < 7.5 || ( p[ 0 ] % 61 == 3 && p[ 1 ] > 2 ) );
+    }
+  bool ok = compareBoundaries( K, image, lower, upper );
+  // Sub-bounds not aligned on words.
+  ok = ok && compareBoundaries( K, image, Z3i::Point( -40, -5, -7 ), Z3i::Point( 25, 8, 3 ) );
+  image.setEncoding( Image::RUN_LENGTH );
+  ok = ok && compareBoundaries( K, image, lower, upper );
+  trace.endBlock();
+  return ok;
+}
+
+bool testBitBoundary2D()
+{
+  typedef ImageContainerByBits<Z2i::Domain> Image;
+  trace.beginBlock ( "Testing word-parallel boundary in 2D ..." );
+  const Z2i::Point lower( 0, 0 ), upper( 63, 40 );
+  Z2i::KSpace K;
+  K.init( lower, upper, true );
+  Image image( Z2i::Domain( lower, upper ) );
+  for ( auto&& p : image.domain() )
+    image.setValue( p, ( p - Z2i::Point( 40, 20 ) ).norm() < 15.0 || p[ 0 ] == 63 );
+  bool ok = compareBoundaries( K, image, lower, upper );
+  trace.endBlock();
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing Surfaces::sMakeBoundary on bit images" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testBitBoundary3D() && testBitBoundary2D();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
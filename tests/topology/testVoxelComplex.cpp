@@ -806,6 +806,36 @@ TEST_CASE_METHOD(Fixture_isthmus, "Thin complex", "[isthmus][thin][function]") {
         CHECK(vc_new.nbCells(3) == 3);
     }
 }
+TEST_CASE_METHOD(Fixture_isthmus, "Parallel thin complex",
+                 "[isthmus][thin][parallel][function]") {
+    using namespace DGtal::functions;
+    using Thinning = VoxelThinning<Domain>;
+    auto &vc = complex_fixture;
+    vc.setSimplicityTable(loadTable(simplicity::tableSimple26_6));
+    SECTION("with skelUltimate") {
+        for (unsigned int threads : {1u, 4u}) {
+            auto vc_new = parallelThinningScheme<FixtureComplex>(
+                vc, Thinning::skelUltimate(), 0, threads);
+            CHECK(vc_new.nbCells(3) == 1);
+        }
+    }
+    SECTION("with skelEnd") {
+        auto vc_new = parallelThinningScheme<FixtureComplex>(
+            vc, Thinning::skelEnd(), 0, 2);
+        // Subfields remove voxels in another order than selectFirst,
+        // hence the end voxels may differ.
+        CHECK(vc_new.nbCells(3) >= 5);
+        CHECK(vc_new.nbCells(3) < vc.nbCells(3));
+        for (auto it = vc_new.begin(3), itE = vc_new.end(3); it != itE; ++it)
+            CHECK(vc.belongs(it->first));
+    }
+    SECTION("with skelIsthmus") {
+        auto table = loadTable(isthmusicity::tableIsthmus);
+        auto vc_new = parallelThinningScheme<FixtureComplex>(
+            vc, Thinning::skelWithTable(table), 0, 2);
+        CHECK(vc_new.nbCells(3) == 3);
+    }
+}
 //
 TEST_CASE_METHOD(Fixture_isthmus, "Persistence thin",
                  "[persistence][isthmus][thin][function]") {
@@ -0,0 +1,160 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testVoxelThinning.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class VoxelThinning.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/VoxelThinning.h"
+#include "DGtal/topology/NeighborhoodConfigurations.h"
+#include "DGtal/topology/tables/NeighborhoodTables.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef VoxelThinning< Domain > Thinning;
+typedef Thinning::BinaryImage   BinaryImage;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class VoxelThinning.
+///////////////////////////////////////////////////////////////////////////////
+
+static BinaryImage makeBox( const Domain & domain, const Point & lo, const Point & up )
+{
+  BinaryImage image( domain );
+  for ( auto p : Domain( lo, up ) ) image.setValue( p, true );
+  return image;
+}
+
+TEST_CASE( "Testing VoxelThinning" )
+{
+  auto simple = functions::loadTable( simplicity::tableSimple26_6 );
+  const Domain domain( Point( -2, -2, -2 ), Point( 70, 12, 9 ) );
+
+  SECTION( "Configurations follow the neighborhood masks" )
+    {
+      BinaryImage image( domain );
+      image.setValue( Point( 1, 2, 3 ), true );
+      Thinning thinning( image, simple );
+      // Only one neighbor at (-1,-1,-1) -> bit 0, at (1,1,1) -> bit 25.
+      REQUIRE( thinning.configuration( Point( 2, 3, 4 ) ) == 1u );
+      REQUIRE( thinning.configuration( Point( 0, 1, 2 ) ) == ( 1u << 25 ) );
+      REQUIRE( thinning.configuration( Point( 1, 2, 3 ) ) == 0u );
+      REQUIRE( thinning.configuration( Point( 2, 2, 3 ) ) == ( 1u << 12 ) );
+    }
+
+  SECTION( "Ultimate thinning of a box gives one voxel" )
+    {
+      const BinaryImage box = makeBox( domain, Point( 0, 0, 0 ), Point( 66, 9, 6 ) );
+      Thinning thinning( box, simple );
+      const auto nb = thinning.thin( Thinning::skelUltimate() );
+      REQUIRE( thinning.image().count() == 1 );
+      REQUIRE( nb == box.count() - 1 );
+      REQUIRE( thinning.isValid() );
+    }
+
+  SECTION( "Thinning keeps tunnels" )
+    {
+      // A thick ring around the z-axis.
+      BinaryImage ring = makeBox( domain, Point( 0, 0, 0 ), Point( 8, 8, 4 ) );
+      for ( auto p : Domain( Point( 3, 3, 0 ), Point( 5, 5, 4 ) ) )
+        ring.setValue( p, false );
+      Thinning thinning( ring, simple );
+      thinning.thin();
+      const auto & result = thinning.image();
+      REQUIRE( result.count() > 4 );
+      // The result is a closed curve: each voxel has exactly 2 neighbors.
+      for ( auto p : domain )
+        if ( result( p ) )
+          REQUIRE( Bits::nbSetBits( thinning.configuration( p ) ) == 2 );
+    }
+
+  SECTION( "Results do not depend on the number of threads" )
+    {
+      BinaryImage image( domain );
+      for ( auto p : domain )
+        {
+          const auto q = p - Point( 33, 5, 4 );
+          if ( q.dot( q ) <= 16 || ( p[ 0 ] % 7 != 0 && ( p[ 1 ] + p[ 2 ] ) % 5 != 0 ) )
+            image.setValue( p, true );
+        }
+      auto isthmus = functions::loadTable( isthmusicity::tableIsthmus );
+      Thinning t1( image, simple, 1 );
+      Thinning t4( image, simple, 4 );
+      t1.thin( Thinning::skelWithTable( isthmus ) );
+      t4.thin( Thinning::skelWithTable( isthmus ) );
+      REQUIRE( t1.image().count() > 0 );
+      REQUIRE( t1.image().count() < image.count() );
+      bool same = true;
+      for ( auto p : domain )
+        same = same && t1.image()( p ) == t4.image()( p )
+          && t1.constraints()( p ) == t4.constraints()( p );
+      REQUIRE( same );
+      Thinning u1( image, simple, 1 );
+      Thinning u4( image, simple, 4 );
+      u1.thin( Thinning::skelUltimate(), 0,
+               [] ( const Point & p ) { return (double) p[ 0 ]; } );
+      u4.thin( Thinning::skelUltimate(), 0,
+               [] ( const Point & p ) { return (double) p[ 0 ]; } );
+      for ( auto p : domain )
+        same = same && u1.image()( p ) == u4.image()( p );
+      REQUIRE( same );
+    }
+
+  SECTION( "Thinning with end voxels and priorities" )
+    {
+      const BinaryImage bar = makeBox( domain, Point( 0, 0, 0 ), Point( 40, 2, 2 ) );
+      Thinning thinning( bar, simple );
+      thinning.thin( Thinning::skelEnd() );
+      // A curve going from one end of the bar to the other.
+      const auto & result = thinning.image();
+      Integer xmin = 100, xmax = -100;
+      for ( auto p : domain )
+        if ( result( p ) )
+          {
+            xmin = std::min( xmin, p[ 0 ] );
+            xmax = std::max( xmax, p[ 0 ] );
+          }
+      REQUIRE( xmin == 0 );
+      REQUIRE( xmax == 40 );
+      REQUIRE( result.count() < bar.count() / 4 );
+      // Voxels of lowest x are removed first.
+      Thinning prior( bar, simple, 2 );
+      prior.thin( Thinning::skelUltimate(), 0,
+                  [] ( const Point & p ) { return (double) p[ 0 ]; } );
+      REQUIRE( prior.image().count() == 1 );
+      for ( auto p : domain )
+        if ( prior.image()( p ) )
+          REQUIRE( p[ 0 ] == 40 );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////